@@ -8,3 +8,6 @@ if(USE_CLANG)
   SET(CMAKE_OBJDUMP       "llvm-objdump")
   SET(CMAKE_RANLIB        "llvm-ranlib")
 endif(USE_CLANG)
+
+set(DISTANCE_TYPE "int64_t" CACHE STRING "signed integer type used for path distances")
+set_property(CACHE DISTANCE_TYPE PROPERTY STRINGS int32_t int64_t)
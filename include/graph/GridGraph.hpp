@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <graph/GridCell.hpp>
 #include <graph/GridGraphIterator.hpp>
 #include <graph/NeigbourCalculator.hpp>
 #include <graph/Node.hpp>
+#include <nonstd/span.hpp>
 #include <optional>
 #include <selection/NodeSelection.hpp>
 #include <separation/Separation.hpp>
@@ -33,6 +35,27 @@ public:
     [[nodiscard]] auto isWalkableNode(Node n) const noexcept
         -> bool;
 
+    // turns a node of the (clipped) grid into a barrier or a walkable node
+    // returns false if the node lies outside of the grid
+    // indexes which were precomputed from the barriers remember the version
+    // they were built for and fall back to exact searches while it differs,
+    // see their isUpToDate
+    auto setBarrier(Node n, bool is_barrier) noexcept
+        -> bool;
+
+    auto toggleBarrier(Node n) noexcept
+        -> bool;
+
+    // changes with every barrier update, engines which cache search
+    // trees use it to detect that their trees are outdated
+    [[nodiscard]] auto getVersion() const noexcept
+        -> std::size_t;
+
+    // the nodes which changed since the given version in the order of the
+    // changes, the i-th node changed the version from i to i + 1
+    [[nodiscard]] auto getChangedNodesSince(std::size_t version) const noexcept
+        -> nonstd::span<const Node>;
+
     [[nodiscard]] auto getWalkableNeigbours(Node n) const noexcept
         -> std::vector<Node>;
 
@@ -91,6 +114,11 @@ public:
     [[nodiscard]] auto countWalkableNodes() const noexcept
         -> std::size_t;
 
+    // fingerprint of the walkable nodes, files which store data of one
+    // barrier layout use it to reject other maps of the same size
+    [[nodiscard]] auto hashBarrierLayout() const noexcept
+        -> std::uint64_t;
+
     [[nodiscard]] auto toClipped(Node n) const noexcept
         -> Node;
 
@@ -149,6 +177,8 @@ private:
     std::size_t width_;
     std::size_t clipped_height_ = 0;
     std::size_t clipped_width_ = 0;
+    std::size_t version_ = 0;
+    std::vector<Node> changes_;
 };
 
 [[nodiscard]] auto parseFileToGridGraph(std::string_view path,
@@ -2,9 +2,13 @@
 
 #include <functional>
 #include <optional>
+#include <pathfinding/CancellationToken.hpp>
+#include <pathfinding/DeadEndPockets.hpp>
 #include <pathfinding/DijkstraQueue.hpp>
 #include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
 #include <pathfinding/Path.hpp>
+#include <pathfinding/SearchBudget.hpp>
 #include <queue>
 #include <string_view>
 #include <vector>
@@ -15,37 +19,137 @@ class GridGraph;
 
 namespace pathfinding {
 
-class AStar
+// weighted A* expands the nodes by g + (1 + epsilon) * h. Focal search expands
+// the node closest to the target among all nodes with
+// g + h <= (1 + epsilon) * min(g + h) and gives a tighter bound.
+// Both find paths at most (1 + epsilon) times longer than the shortest path
+enum class SuboptimalSearch {
+    WEIGHTED,
+    FOCAL
+};
+
+// if StorePredecessors is false, no predecessors are stored or updated and
+// only distances can be queried. The instantiations are in AStar.cpp
+template<bool StorePredecessors>
+class BasicAStar
 {
 public:
     static constexpr auto is_thread_save = false;
 
-    AStar(const graph::GridGraph& graph) noexcept;
-    AStar() = delete;
-    AStar(AStar&&) = default;
-    AStar(const AStar&) = default;
-    auto operator=(const AStar&) -> AStar& = delete;
-    auto operator=(AStar&&) -> AStar& = delete;
+    BasicAStar(const graph::GridGraph& graph,
+               Heuristic heuristic = ManhattanHeuristic{}) noexcept;
 
+    // skips all dead end pockets which contain neither the source nor the target
+    BasicAStar(const graph::GridGraph& graph,
+               const DeadEndPockets& pockets,
+               Heuristic heuristic = ManhattanHeuristic{}) noexcept;
+    BasicAStar() = delete;
+    BasicAStar(BasicAStar&&) = default;
+    BasicAStar(const BasicAStar&) = default;
+    auto operator=(const BasicAStar&) -> BasicAStar& = delete;
+    auto operator=(BasicAStar&&) -> BasicAStar& = delete;
+
+    template<bool HasPredecessors = StorePredecessors>
     [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
-        -> std::optional<Path>;
+        -> std::optional<Path>
+    {
+        static_assert(HasPredecessors,
+                      "routes need the predecessors, use AStar");
+
+        if(graph::UNREACHABLE == computeDistance(source, target)) {
+            return std::nullopt;
+        }
+
+        return extractShortestPath(source, target);
+    }
+
+    // if the budget is used up, the path leads to the most promising node of
+    // the search frontier. A later exact query with the same source and
+    // target continues the search where it stopped
+    template<bool HasPredecessors = StorePredecessors>
+    [[nodiscard]] auto findRoute(graph::Node source,
+                                 graph::Node target,
+                                 const SearchBudget& budget) noexcept
+        -> BoundedRoute
+    {
+        static_assert(HasPredecessors,
+                      "routes need the predecessors, use AStar");
+
+        const auto distance = findDistance(source, target, budget);
+
+        if(distance.budget_exceeded) {
+            return BoundedRoute{distance, extractShortestPath(source, frontier_.value())};
+        }
+
+        if(graph::UNREACHABLE == distance.upper_bound) {
+            return BoundedRoute{distance, std::nullopt};
+        }
+
+        return BoundedRoute{distance, extractShortestPath(source, target)};
+    }
 
     [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
         -> graph::Distance;
 
-private:
-    [[nodiscard]] auto findTrivialDistance(graph::Node source, graph::Node target) noexcept
-        -> graph::Distance;
+    [[nodiscard]] auto findDistance(graph::Node source,
+                                    graph::Node target,
+                                    const SearchBudget& budget) noexcept
+        -> BoundedDistance;
+
+    // searches stop as soon as the token is cancelled and return UNREACHABLE
+    auto setCancellationToken(std::optional<CancellationToken> token) noexcept
+        -> void;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+    // an epsilon of 0 turns the search back into an exact search
+    auto setSuboptimality(double epsilon,
+                          SuboptimalSearch search = SuboptimalSearch::WEIGHTED) noexcept
+        -> void;
+
+    // upper bound of the ratio between the distance of the last query and
+    // the shortest distance, 1 for exact searches
+    [[nodiscard]] auto getSuboptimalityBound() const noexcept
+        -> double;
+
+    // bytes of the per node search state, it grows with the touched nodes
+    [[nodiscard]] auto getMemoryUsage() const noexcept
+        -> std::size_t;
 
+private:
     [[nodiscard]] auto getDistanceTo(graph::Node n) const noexcept
         -> graph::Distance;
 
-    auto setDistanceTo(graph::Node n, std::int64_t distance) noexcept
+    auto setDistanceTo(graph::Node n, graph::Distance distance) noexcept
         -> void;
 
     [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
         -> graph::Distance;
 
+    template<class HeuristicPolicy>
+    [[nodiscard]] auto search(const HeuristicPolicy& heuristic,
+                              graph::Node source,
+                              graph::Node target) noexcept
+        -> graph::Distance;
+
+    template<class HeuristicPolicy>
+    [[nodiscard]] auto weightedSearch(const HeuristicPolicy& heuristic,
+                                      graph::Node source,
+                                      graph::Node target) noexcept
+        -> graph::Distance;
+
+    template<class HeuristicPolicy>
+    [[nodiscard]] auto focalSearch(const HeuristicPolicy& heuristic,
+                                   graph::Node source,
+                                   graph::Node target) noexcept
+        -> graph::Distance;
+
+    // remembers the state of a search which used up its budget
+    auto stopSearch(graph::Node frontier, graph::Distance lower_bound) noexcept
+        -> graph::Distance;
+
     [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) const noexcept
         -> std::optional<Path>;
 
@@ -64,15 +168,38 @@ private:
     auto setBefore(graph::Node n, graph::Node before) noexcept
         -> void;
 
+    [[nodiscard]] auto isAllowed(graph::Node n) const noexcept
+        -> bool;
+
+    auto updatePockets(graph::Node source, graph::Node target) noexcept
+        -> void;
+
 private:
     const std::reference_wrapper<const graph::GridGraph> graph_;
+    Heuristic heuristic_;
     std::vector<graph::Distance> distances_;
     std::vector<bool> settled_;
     std::vector<graph::Node> touched_;
     AStarQueue pq_;
     std::optional<graph::Node> last_source_;
+    std::size_t last_graph_version_;
+    std::optional<std::reference_wrapper<const DeadEndPockets>> pockets_;
+    DeadEndPockets::PocketId source_pocket_ = DeadEndPockets::NO_POCKET;
+    DeadEndPockets::PocketId target_pocket_ = DeadEndPockets::NO_POCKET;
+    std::optional<graph::Node> last_target_;
     std::vector<graph::Node> before_;
+    std::optional<CancellationToken> cancellation_token_;
+    const SearchBudget* budget_ = nullptr;
+    bool budget_exceeded_ = false;
+    graph::Distance budget_lower_bound_ = 0;
+    std::optional<graph::Node> frontier_;
+    std::size_t expanded_nodes_ = 0;
+    double epsilon_ = 0;
+    SuboptimalSearch suboptimal_search_ = SuboptimalSearch::WEIGHTED;
+    double suboptimality_bound_ = 1;
 };
 
+using AStar = BasicAStar<true>;
+using DistanceAStar = BasicAStar<false>;
 
 } // namespace pathfinding
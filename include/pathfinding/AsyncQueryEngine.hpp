@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <graph/GridGraph.hpp>
+#include <graph/Node.hpp>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <pathfinding/CancellationToken.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <thread>
+#include <vector>
+
+namespace pathfinding {
+
+// answers single queries on a fixed number of worker threads without
+// blocking the calling thread. Every worker owns its own PathFinder, which
+// needs to support setCancellationToken (GridGraphDijkstra, AStar, ...).
+// At most queue_capacity queries wait for a worker, further queries are
+// rejected instead of blocking the caller
+template<class PathFinder>
+class AsyncQueryEngine
+{
+public:
+    // the result is std::nullopt if the query was cancelled, for routes
+    // also if the target is not reachable
+    template<class Result>
+    struct Handle
+    {
+        std::future<std::optional<Result>> result;
+        CancellationToken token;
+    };
+
+    using DistanceHandle = Handle<graph::Distance>;
+    using RouteHandle = Handle<Path>;
+
+    AsyncQueryEngine(const graph::GridGraph& graph,
+                     std::size_t number_of_workers,
+                     std::size_t queue_capacity) noexcept
+        : queue_capacity_(queue_capacity),
+          running_tokens_(std::max(number_of_workers, std::size_t{1}))
+    {
+        for(std::size_t worker_idx = 0; worker_idx < running_tokens_.size(); worker_idx++) {
+            workers_.emplace_back([this, &graph, worker_idx] {
+                PathFinder path_finder{graph};
+                work(worker_idx, path_finder);
+            });
+        }
+    }
+
+    AsyncQueryEngine() = delete;
+    AsyncQueryEngine(AsyncQueryEngine&&) = delete;
+    AsyncQueryEngine(const AsyncQueryEngine&) = delete;
+    auto operator=(const AsyncQueryEngine&) -> AsyncQueryEngine& = delete;
+    auto operator=(AsyncQueryEngine&&) -> AsyncQueryEngine& = delete;
+
+    // cancels all queries which did not finish yet
+    ~AsyncQueryEngine() noexcept
+    {
+        {
+            std::lock_guard lock{mutex_};
+            stopped_ = true;
+            for(auto& query : queue_) {
+                query.token.cancel();
+            }
+            for(auto& token : running_tokens_) {
+                if(token) {
+                    token->cancel();
+                }
+            }
+        }
+
+        work_available_.notify_all();
+
+        for(auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // returns std::nullopt if the queue is full
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> std::optional<DistanceHandle>
+    {
+        return submit<graph::Distance>(
+            [source, target](PathFinder& path_finder) {
+                return std::optional{path_finder.findDistance(source, target)};
+            });
+    }
+
+    // returns std::nullopt if the queue is full
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<RouteHandle>
+    {
+        return submit<Path>(
+            [source, target](PathFinder& path_finder) {
+                return path_finder.findRoute(source, target);
+            });
+    }
+
+    [[nodiscard]] auto getNumberOfQueuedQueries() const noexcept
+        -> std::size_t
+    {
+        std::lock_guard lock{mutex_};
+        return queue_.size();
+    }
+
+    [[nodiscard]] auto getNumberOfRejectedQueries() const noexcept
+        -> std::size_t
+    {
+        std::lock_guard lock{mutex_};
+        return rejected_queries_;
+    }
+
+private:
+    struct Query
+    {
+        // runs the query and fulfills its promise, std::nullopt is used as
+        // result if the token was cancelled before or during the search
+        std::function<void(PathFinder&)> run;
+        CancellationToken token;
+    };
+
+    template<class Result, class Search>
+    [[nodiscard]] auto submit(Search search) noexcept
+        -> std::optional<Handle<Result>>
+    {
+        std::lock_guard lock{mutex_};
+
+        if(queue_.size() >= queue_capacity_ or stopped_) {
+            rejected_queries_++;
+            return std::nullopt;
+        }
+
+        //std::function needs to be copyable, so the promise is shared
+        auto promise = std::make_shared<std::promise<std::optional<Result>>>();
+        CancellationToken token;
+        Handle<Result> handle{promise->get_future(), token};
+
+        auto run = [promise, token, search](PathFinder& path_finder) {
+            if(token.isCancelled()) {
+                promise->set_value(std::nullopt);
+                return;
+            }
+
+            path_finder.setCancellationToken(token);
+            auto result = search(path_finder);
+            path_finder.setCancellationToken(std::nullopt);
+
+            if(token.isCancelled()) {
+                promise->set_value(std::nullopt);
+                return;
+            }
+
+            promise->set_value(std::move(result));
+        };
+
+        queue_.push_back(Query{std::move(run), std::move(token)});
+        work_available_.notify_one();
+
+        return handle;
+    }
+
+    auto work(std::size_t worker_idx, PathFinder& path_finder) noexcept
+        -> void
+    {
+        while(true) {
+            std::unique_lock lock{mutex_};
+            work_available_.wait(lock, [this] {
+                return stopped_ or !queue_.empty();
+            });
+
+            //queued queries are cancelled when stopping, but their
+            //promises still need to be fulfilled
+            if(queue_.empty()) {
+                return;
+            }
+
+            auto query = std::move(queue_.front());
+            queue_.pop_front();
+            running_tokens_[worker_idx] = query.token;
+            lock.unlock();
+
+            query.run(path_finder);
+
+            lock.lock();
+            running_tokens_[worker_idx] = std::nullopt;
+        }
+    }
+
+private:
+    const std::size_t queue_capacity_;
+    mutable std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::deque<Query> queue_;
+    // token of the query each worker is running
+    std::vector<std::optional<CancellationToken>> running_tokens_;
+    std::vector<std::thread> workers_;
+    std::size_t rejected_queries_ = 0;
+    bool stopped_ = false;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/LocalDistanceDatabase.hpp>
+#include <pathfinding/Path.hpp>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace pathfinding {
+
+// A* which expands whole blocks of a LocalDistanceDatabase instead of single
+// nodes. The perimeter nodes of a block whose distance improved since the
+// block was expanded last are its ingress nodes. Expanding the block updates
+// all of its perimeter nodes with the local distances and pushes the result
+// over the border into the neigbouring blocks.
+// The search stops as soon as no queued block can improve the distance of
+// the target, blocks can be expanded more than once.
+// While the database is outdated, the queries are answered by A* on the grid
+class BlockAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    BlockAStar(const LocalDistanceDatabase& database) noexcept;
+    BlockAStar() = delete;
+    BlockAStar(BlockAStar&&) = default;
+    BlockAStar(const BlockAStar&) = default;
+    auto operator=(const BlockAStar&) -> BlockAStar& = delete;
+    auto operator=(BlockAStar&&) -> BlockAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // number of blocks which were expanded while answering the last query
+    // 0 if it was answered on the grid
+    [[nodiscard]] auto getNumberOfExpandedBlocks() const noexcept
+        -> std::size_t;
+
+private:
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // updates the perimeter of the block from its ingress nodes
+    auto expand(std::size_t block, std::uint32_t ingress) noexcept
+        -> void;
+
+    // pushes the distances of the given perimeter nodes of the block over its
+    // border and to the target
+    auto propagate(std::size_t block, std::uint32_t egress) noexcept
+        -> void;
+
+    auto relax(graph::Node n, graph::Distance distance, graph::Node before) noexcept
+        -> bool;
+
+    [[nodiscard]] auto getDistanceTo(graph::Node n) const noexcept
+        -> graph::Distance;
+
+    // appends a shortest path inside the block of the last node to the target
+    auto refineSegment(std::vector<graph::Node>& nodes, graph::Node target) const noexcept
+        -> void;
+
+    [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) const noexcept
+        -> std::optional<Path>;
+
+    auto reset() noexcept
+        -> void;
+
+    // created on the first query with an outdated database
+    [[nodiscard]] auto getGridSearch() noexcept
+        -> AStar&;
+
+private:
+    // blocks are ordered by f, ties are broken in favour of the block which
+    // is closer to the target
+    using BlockQueue = std::priority_queue<std::tuple<graph::Distance, graph::Distance, std::size_t>,
+                                           std::vector<std::tuple<graph::Distance, graph::Distance, std::size_t>>,
+                                           std::greater<>>;
+
+    const std::reference_wrapper<const LocalDistanceDatabase> database_;
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<std::size_t> touched_;
+
+    // bit i is set if the i-th perimeter node of the block is an ingress node
+    std::vector<std::uint32_t> ingress_;
+    std::vector<std::size_t> touched_blocks_;
+
+    graph::Node target_;
+    std::size_t target_block_;
+    LocalDistanceDatabase::LocalDistances to_target_;
+    graph::Distance target_distance_;
+    graph::Node target_before_;
+
+    BlockQueue pq_;
+    std::optional<AStar> grid_search_;
+    std::size_t expanded_blocks_ = 0;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace pathfinding {
+
+// shared flag to stop running searches from another thread. Copies of a
+// token share the same flag, searches check it once per expanded node
+class CancellationToken
+{
+public:
+    CancellationToken() noexcept
+        : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    auto cancel() const noexcept
+        -> void
+    {
+        cancelled_->store(true, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto isCancelled() const noexcept
+        -> bool
+    {
+        return cancelled_->load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/DijkstraQueue.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// A* for 8-connected grids which only generates canonical successors:
+// diagonal moves are taken before cardinal moves, so every shortest path
+// between two nodes in an open area is found exactly once.
+// Diagonal moves must not cut a corner, both cardinal nodes next to the move
+// need to be walkable. Costs are scaled integers, see CARDINAL_COST and
+// DIAGONAL_COST
+class CanonicalOctileAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+    static constexpr graph::Distance CARDINAL_COST = 100;
+    static constexpr graph::Distance DIAGONAL_COST = 141;
+
+    // the scaled costs overflow small distance types after a few hundred moves
+    static_assert(sizeof(graph::Distance) >= 4,
+                  "the scaled costs need a distance type with at least 32 bits");
+
+    CanonicalOctileAStar(const graph::GridGraph& graph) noexcept;
+    CanonicalOctileAStar() = delete;
+    CanonicalOctileAStar(CanonicalOctileAStar&&) = default;
+    CanonicalOctileAStar(const CanonicalOctileAStar&) = default;
+    auto operator=(const CanonicalOctileAStar&) -> CanonicalOctileAStar& = delete;
+    auto operator=(CanonicalOctileAStar&&) -> CanonicalOctileAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+    // distance between two nodes on an 8-connected grid without barriers
+    [[nodiscard]] static auto octileDistance(graph::Node from, graph::Node to) noexcept
+        -> graph::Distance;
+
+private:
+    // one bit per move direction, a node remembers all directions it was
+    // reached from on a shortest path
+    using DirectionSet = std::uint16_t;
+
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // calls visit(neigbour, direction) for the canonical successors of a node
+    // which was reached by the given directions
+    template<class Visitor>
+    auto forEachCanonicalSuccessor(graph::Node n,
+                                   DirectionSet directions,
+                                   Visitor visit) const noexcept
+        -> void;
+
+    [[nodiscard]] auto canMove(graph::Node n, std::size_t direction) const noexcept
+        -> bool;
+
+    [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) const noexcept
+        -> std::optional<Path>;
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<DirectionSet> reached_from_;
+    std::vector<DirectionSet> expanded_from_;
+    std::vector<std::size_t> touched_;
+    AStarQueue pq_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
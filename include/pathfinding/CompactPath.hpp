@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/Path.hpp>
+#include <vector>
+
+namespace pathfinding {
+
+// stores a path as its source and one direction code per step
+// manhattan paths use 2 bits per step, paths with diagonal steps 3 bits
+class CompactPath
+{
+public:
+    CompactPath(graph::Node source) noexcept;
+    CompactPath() = delete;
+    CompactPath(CompactPath&&) = default;
+    CompactPath(const CompactPath&) = default;
+    auto operator=(const CompactPath&) -> CompactPath& = default;
+    auto operator=(CompactPath&&) -> CompactPath& = default;
+
+    [[nodiscard]] auto getSource() const noexcept
+        -> graph::Node;
+
+    [[nodiscard]] auto getLength() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getBitsPerStep() const noexcept
+        -> std::size_t;
+
+    // number of bytes needed to store the path
+    [[nodiscard]] auto byteSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto toPath() const noexcept
+        -> Path;
+
+private:
+    friend auto compressPath(const Path& path) noexcept
+        -> std::optional<CompactPath>;
+
+    auto pushBack(std::uint8_t direction) noexcept
+        -> void;
+
+    [[nodiscard]] auto getDirection(std::size_t step) const noexcept
+        -> std::uint8_t;
+
+private:
+    graph::Node source_;
+    std::size_t bits_per_step_ = 2;
+    std::size_t length_ = 0;
+    std::vector<std::uint64_t> steps_;
+};
+
+// returns nullopt if two consecutive nodes of the path are not neigbours
+auto compressPath(const Path& path) noexcept
+    -> std::optional<CompactPath>;
+
+} // namespace pathfinding
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <string_view>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+class CachingGridGraphDijkstra;
+
+// stores the first move of a shortest path from every source to every target
+// the rows of the sources are run length encoded, the targets are ordered by
+// their morton code (zScore) to get long runs of equal moves
+class CompressedPathDatabase
+{
+public:
+    static constexpr auto is_thread_save = true;
+
+    CompressedPathDatabase(const graph::GridGraph& graph) noexcept;
+
+    // builds the rows from the already computed all pairs distances
+    CompressedPathDatabase(const CachingGridGraphDijkstra& apsp) noexcept;
+
+    CompressedPathDatabase() = delete;
+    CompressedPathDatabase(CompressedPathDatabase&&) = default;
+    CompressedPathDatabase(const CompressedPathDatabase&) = default;
+    auto operator=(const CompressedPathDatabase&) -> CompressedPathDatabase& = delete;
+    auto operator=(CompressedPathDatabase&&) -> CompressedPathDatabase& = delete;
+
+    // both fall back to a search on the grid while the rows are outdated
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) const noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) const noexcept
+        -> graph::Distance;
+
+    // false if barriers changed since the first moves were computed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    // number of bytes used by the compressed rows
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfRuns() const noexcept
+        -> std::size_t;
+
+    auto toFile(std::string_view path) const noexcept
+        -> bool;
+
+private:
+    using Move = std::uint8_t;
+    using Rank = std::uint32_t;
+
+    // index of the neigbour in GridGraph::getManhattanNeigbours
+    // NO_MOVE is used for unreachable targets and for the source itself
+    static constexpr Move NO_MOVE = 4;
+
+    friend auto compressedPathDatabaseFromFile(const graph::GridGraph& graph,
+                                               std::string_view path) noexcept
+        -> std::optional<CompressedPathDatabase>;
+
+    CompressedPathDatabase(const graph::GridGraph& graph,
+                           std::vector<Rank> ranks,
+                           std::vector<std::size_t> row_offsets,
+                           std::vector<Rank> run_starts,
+                           std::vector<Move> run_moves) noexcept;
+
+    [[nodiscard]] auto calculateRanks() const noexcept
+        -> std::vector<Rank>;
+
+    template<class RowCalculator>
+    auto buildRows(RowCalculator calculate_row) noexcept
+        -> void;
+
+    [[nodiscard]] auto findFirstMove(graph::Node source, graph::Node target) const noexcept
+        -> Move;
+
+    template<class Visitor>
+    [[nodiscard]] auto followMoves(graph::Node source,
+                                   graph::Node target,
+                                   Visitor visit) const noexcept
+        -> bool;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+
+    // morton rank of every walkable node, indexed by the node index
+    std::vector<Rank> ranks_;
+
+    // runs of the source with rank r are stored in [row_offsets_[r], row_offsets_[r + 1])
+    // every run starts at the target rank run_starts_[i] and has the move run_moves_[i]
+    std::vector<std::size_t> row_offsets_;
+    std::vector<Rank> run_starts_;
+    std::vector<Move> run_moves_;
+};
+
+auto compressedPathDatabaseFromFile(const graph::GridGraph& graph,
+                                    std::string_view path) noexcept
+    -> std::optional<CompressedPathDatabase>;
+
+} // namespace pathfinding
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// finds dead end pockets of the graph, parts which are only connected to the
+// rest of the graph through a single articulation node. A shortest path
+// between two nodes outside of a pocket never enters the pocket
+// the pockets need to be recomputed after barriers of the graph changed,
+// until then nothing is pruned
+class DeadEndPockets
+{
+public:
+    using PocketId = std::uint32_t;
+    static constexpr PocketId NO_POCKET = 0;
+
+    DeadEndPockets(const graph::GridGraph& graph) noexcept;
+    DeadEndPockets() = delete;
+    DeadEndPockets(DeadEndPockets&&) = default;
+    DeadEndPockets(const DeadEndPockets&) = delete;
+    auto operator=(const DeadEndPockets&) -> DeadEndPockets& = delete;
+    auto operator=(DeadEndPockets&&) -> DeadEndPockets& = delete;
+
+    // id of the outermost pocket containing the node or NO_POCKET
+    [[nodiscard]] auto getPocket(graph::Node n) const noexcept
+        -> PocketId;
+
+    // a node can lie on a shortest path between source and target if it is
+    // in no pocket or in the pocket of the source or the target
+    // every node is allowed if the pockets are outdated
+    [[nodiscard]] auto isAllowed(graph::Node n,
+                                 PocketId source_pocket,
+                                 PocketId target_pocket) const noexcept
+        -> bool;
+
+    // false if barriers changed since the pockets were computed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    [[nodiscard]] auto getNumberOfPockets() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto countPocketNodes() const noexcept
+        -> std::size_t;
+
+private:
+    auto findPockets() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+    std::vector<PocketId> pockets_;
+    std::size_t number_of_pockets_ = 0;
+};
+
+} // namespace pathfinding
@@ -1,11 +1,26 @@
 #pragma once
 
-#include <limits>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// the distance type can be chosen at build time with the cmake option
+// DISTANCE_TYPE, int32_t reduces the size of every distance array, queue
+// and index
+#ifndef GRID_GRAPH_DISTANCE_TYPE
+#define GRID_GRAPH_DISTANCE_TYPE std::int64_t
+#endif
 
 namespace graph {
 
-using Distance = std::int64_t;
+using Distance = GRID_GRAPH_DISTANCE_TYPE;
 constexpr inline auto UNREACHABLE = std::numeric_limits<Distance>::max();
 
+// separations use -1 as marker for trivial separations
+static_assert(std::is_integral_v<Distance> and std::is_signed_v<Distance>,
+              "the distance type needs to be a signed integer");
+// paths on large maps are longer than 2^16 steps
+static_assert(sizeof(Distance) >= sizeof(std::int32_t),
+              "the distance type needs at least 32 bits");
+
 } // namespace graph
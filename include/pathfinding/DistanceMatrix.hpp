@@ -0,0 +1,52 @@
+#pragma once
+
+#include <graph/Node.hpp>
+#include <nonstd/span.hpp>
+#include <pathfinding/Distance.hpp>
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// all distances between the sources and the targets, the results are stored
+// row by row: results[i * targets.size() + j] is the distance from sources[i]
+// to targets[j]. results needs to have at least sources.size() * targets.size()
+// entries.
+// One breadth first search is run per source in parallel, or per target if
+// there are fewer targets. A search stops as soon as all nodes of the other
+// side are reached
+auto distanceMatrix(const graph::GridGraph& graph,
+                    nonstd::span<const graph::Node> sources,
+                    nonstd::span<const graph::Node> targets,
+                    nonstd::span<graph::Distance> results) noexcept
+    -> void;
+
+// looks up all entries in parallel, for oracles which answer queries without
+// searching (HubLabelDistanceOracle, CachingGridGraphDijkstra, ...)
+template<class Oracle>
+auto distanceMatrix(const Oracle& oracle,
+                    nonstd::span<const graph::Node> sources,
+                    nonstd::span<const graph::Node> targets,
+                    nonstd::span<graph::Distance> results) noexcept
+    -> void
+{
+    static_assert(Oracle::is_thread_save, "the oracle needs to be threadsave");
+
+    const tbb::blocked_range2d<std::size_t> matrix{0, sources.size(),
+                                                   0, targets.size()};
+
+    tbb::parallel_for(matrix,
+                      [&](const auto& range) {
+                          for(auto i = range.rows().begin(); i != range.rows().end(); i++) {
+                              for(auto j = range.cols().begin(); j != range.cols().end(); j++) {
+                                  results[i * targets.size() + j] = oracle.findDistance(sources[i], targets[j]);
+                              }
+                          }
+                      });
+}
+
+} // namespace pathfinding
@@ -2,9 +2,12 @@
 
 #include <functional>
 #include <optional>
+#include <pathfinding/CancellationToken.hpp>
+#include <pathfinding/DeadEndPockets.hpp>
 #include <pathfinding/DijkstraQueue.hpp>
 #include <pathfinding/Distance.hpp>
 #include <pathfinding/Path.hpp>
+#include <pathfinding/SearchBudget.hpp>
 #include <queue>
 #include <string_view>
 #include <vector>
@@ -15,32 +18,65 @@ class GridGraph;
 
 namespace pathfinding {
 
-class GridGraphDijkstra
+// if StorePredecessors is false, no predecessors are stored or updated and
+// only distances can be queried. The instantiations are in GridGraphDijkstra.cpp
+template<bool StorePredecessors>
+class BasicGridGraphDijkstra
 {
 public:
     static constexpr auto is_thread_save = false;
 
-    GridGraphDijkstra(const graph::GridGraph& graph) noexcept;
-    GridGraphDijkstra() = delete;
-    GridGraphDijkstra(GridGraphDijkstra&&) = default;
-    GridGraphDijkstra(const GridGraphDijkstra&) = default;
-    auto operator=(const GridGraphDijkstra&) -> GridGraphDijkstra& = delete;
-    auto operator=(GridGraphDijkstra&&) -> GridGraphDijkstra& = delete;
+    BasicGridGraphDijkstra(const graph::GridGraph& graph) noexcept;
 
+    // skips all dead end pockets which contain neither the source nor the target
+    BasicGridGraphDijkstra(const graph::GridGraph& graph,
+                           const DeadEndPockets& pockets) noexcept;
+    BasicGridGraphDijkstra() = delete;
+    BasicGridGraphDijkstra(BasicGridGraphDijkstra&&) = default;
+    BasicGridGraphDijkstra(const BasicGridGraphDijkstra&) = default;
+    auto operator=(const BasicGridGraphDijkstra&) -> BasicGridGraphDijkstra& = delete;
+    auto operator=(BasicGridGraphDijkstra&&) -> BasicGridGraphDijkstra& = delete;
+
+    template<bool HasPredecessors = StorePredecessors>
     [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
-        -> std::optional<Path>;
+        -> std::optional<Path>
+    {
+        static_assert(HasPredecessors,
+                      "routes need the predecessors, use GridGraphDijkstra");
+
+        if(graph::UNREACHABLE == computeDistance(source, target)) {
+            return std::nullopt;
+        }
+
+        return extractShortestPath(source, target);
+    }
 
     [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
         -> graph::Distance;
 
+    // stops the search when the budget is used up, a later query from the
+    // same source continues the search where it stopped
+    [[nodiscard]] auto findDistance(graph::Node source,
+                                    graph::Node target,
+                                    const SearchBudget& budget) noexcept
+        -> BoundedDistance;
+
+    // searches stop as soon as the token is cancelled and return UNREACHABLE
+    auto setCancellationToken(std::optional<CancellationToken> token) noexcept
+        -> void;
+
     [[nodiscard]] auto findTrivialDistance(graph::Node source, graph::Node target) noexcept
         -> graph::Distance;
 
+    // bytes of the per node search state, it grows with the touched nodes
+    [[nodiscard]] auto getMemoryUsage() const noexcept
+        -> std::size_t;
+
 protected:
     [[nodiscard]] auto getDistanceTo(graph::Node n) const noexcept
         -> graph::Distance;
 
-    auto setDistanceTo(graph::Node n, std::int64_t distance) noexcept
+    auto setDistanceTo(graph::Node n, graph::Distance distance) noexcept
         -> void;
 
     [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
@@ -64,6 +100,12 @@ protected:
     auto setBefore(graph::Node n, graph::Node before) noexcept
         -> void;
 
+    [[nodiscard]] auto isAllowed(graph::Node n) const noexcept
+        -> bool;
+
+    auto updatePockets(graph::Node source, graph::Node target) noexcept
+        -> void;
+
 private:
     const std::reference_wrapper<const graph::GridGraph> graph_;
     std::vector<graph::Distance> distances_;
@@ -71,8 +113,17 @@ private:
     std::vector<graph::Node> touched_;
     DijkstraQueue pq_;
     std::optional<graph::Node> last_source_;
+    std::size_t last_graph_version_;
+    std::optional<std::reference_wrapper<const DeadEndPockets>> pockets_;
+    DeadEndPockets::PocketId source_pocket_ = DeadEndPockets::NO_POCKET;
+    DeadEndPockets::PocketId target_pocket_ = DeadEndPockets::NO_POCKET;
     std::vector<graph::Node> before_;
+    std::optional<CancellationToken> cancellation_token_;
+    const SearchBudget* budget_ = nullptr;
+    bool budget_exceeded_ = false;
 };
 
+using GridGraphDijkstra = BasicGridGraphDijkstra<true>;
+using DistanceGridGraphDijkstra = BasicGridGraphDijkstra<false>;
 
 } // namespace pathfinding
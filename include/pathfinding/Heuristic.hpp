@@ -0,0 +1,34 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Landmarks.hpp>
+#include <variant>
+
+namespace pathfinding {
+
+class ManhattanHeuristic
+{
+public:
+    [[nodiscard]] auto estimateDistance(const graph::Node& from, const graph::Node& to) const noexcept
+        -> graph::Distance;
+};
+
+// uses the max of the manhattan distance and the landmark bounds
+class LandmarkHeuristic
+{
+public:
+    LandmarkHeuristic(const Landmarks& landmarks) noexcept;
+
+    [[nodiscard]] auto estimateDistance(const graph::Node& from, const graph::Node& to) const noexcept
+        -> graph::Distance;
+
+private:
+    std::reference_wrapper<const Landmarks> landmarks_;
+};
+
+using Heuristic = std::variant<ManhattanHeuristic,
+                               LandmarkHeuristic>;
+
+} // namespace pathfinding
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/DijkstraQueue.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/HierarchicalGraph.hpp>
+#include <pathfinding/Path.hpp>
+#include <vector>
+
+namespace pathfinding {
+
+// A* on the abstraction of a HierarchicalGraph. Nodes in the leaf cells of
+// the source and the target are expanded on the grid. Every other node is
+// expanded in the coarsest cell which contains neither the source nor the
+// target, it is an entrance of this cell and crosses it with the cached
+// distances. Only the cells on the found abstract path are refined.
+// While the hierarchy misses barrier changes all nodes are expanded on the
+// grid
+class HierarchicalAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    HierarchicalAStar(const HierarchicalGraph& hierarchy) noexcept;
+    HierarchicalAStar() = delete;
+    HierarchicalAStar(HierarchicalAStar&&) = default;
+    HierarchicalAStar(const HierarchicalAStar&) = default;
+    auto operator=(const HierarchicalAStar&) -> HierarchicalAStar& = delete;
+    auto operator=(HierarchicalAStar&&) -> HierarchicalAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+private:
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // coarsest level on which the cell of the node contains neither the
+    // source nor the target, nullopt for nodes in their leaf cells
+    [[nodiscard]] auto findQueryLevel(graph::Node n,
+                                      graph::Node source,
+                                      graph::Node target) const noexcept
+        -> std::optional<std::size_t>;
+
+    // appends a shortest path inside the cell from the last node to the target
+    auto refineSegment(std::vector<graph::Node>& nodes,
+                       const graph::GridCell& cell,
+                       graph::Node target) noexcept
+        -> void;
+
+    [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const HierarchicalGraph> hierarchy_;
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<std::size_t> touched_;
+
+    // breadth first search inside a cell during the refinement
+    std::vector<graph::Distance> refine_distances_;
+    std::vector<graph::Node> refine_queue_;
+
+    AStarQueue pq_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
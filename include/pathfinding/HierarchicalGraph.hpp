@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/GridCell.hpp>
+#include <graph/Node.hpp>
+#include <limits>
+#include <nonstd/span.hpp>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// multi level abstraction of the grid on the GridCell quadtree. The grid is
+// wrapped in a square cell whose side is a power of two and split until the
+// cells have leaf_size nodes per side, the lowest number_of_levels depths of
+// the quadtree are kept. Level 0 is the coarsest kept level.
+// The entrances of a cell are its walkable nodes with a walkable neigbour in
+// another cell of the same level. Every cell caches the distances between
+// its entrances on paths inside the cell, so a search can cross a cell with
+// a single edge. Memory is linear in the number of nodes for a fixed number
+// of levels
+class HierarchicalGraph
+{
+public:
+    static constexpr auto NO_ENTRANCE = std::numeric_limits<std::uint32_t>::max();
+
+    // leaf_size is rounded up to a power of two
+    HierarchicalGraph(const graph::GridGraph& graph,
+                      std::size_t leaf_size = 8,
+                      std::size_t number_of_levels = 3) noexcept;
+    HierarchicalGraph() = delete;
+    HierarchicalGraph(HierarchicalGraph&&) = default;
+    HierarchicalGraph(const HierarchicalGraph&) = delete;
+    auto operator=(const HierarchicalGraph&) -> HierarchicalGraph& = delete;
+    auto operator=(HierarchicalGraph&&) -> HierarchicalGraph& = delete;
+
+    [[nodiscard]] auto getNumberOfLevels() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfCells(std::size_t level) const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getCellId(std::size_t level, graph::Node n) const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getCell(std::size_t level, std::size_t cell) const noexcept
+        -> const graph::GridCell&;
+
+    [[nodiscard]] auto getEntrances(std::size_t level, std::size_t cell) const noexcept
+        -> nonstd::span<const graph::Node>;
+
+    // index of the node in the entrances of its cell, NO_ENTRANCE if the
+    // node is no entrance on this level
+    [[nodiscard]] auto getEntranceIndex(std::size_t level, graph::Node n) const noexcept
+        -> std::uint32_t;
+
+    // distance inside the cell between two of its entrances
+    [[nodiscard]] auto getCellDistance(std::size_t level,
+                                       std::size_t cell,
+                                       std::size_t from_entrance,
+                                       std::size_t to_entrance) const noexcept
+        -> graph::Distance;
+
+    // local re-abstraction after the node changed between walkable and
+    // barrier. Only the cells of the node and its neigbours are recomputed,
+    // so it has to be called for every changed node
+    auto update(graph::Node changed) noexcept
+        -> void;
+
+    // false if a node changed which was not passed to update since, the
+    // cached distances may be wrong then
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    // number of bytes used by the entrances and the cached distances
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getGraph() const noexcept
+        -> const graph::GridGraph&;
+
+private:
+    struct AbstractCell
+    {
+        graph::GridCell cell;
+        std::vector<graph::Node> entrances;
+
+        // distance from entrance i to entrance j is at i * entrances.size() + j
+        std::vector<graph::Distance> distances;
+    };
+
+    // collects the cells of every kept level by splitting the quadtree
+    auto buildCells(const graph::GridCell& cell, std::size_t depth) noexcept
+        -> void;
+
+    auto abstractCell(std::size_t level, std::size_t cell) noexcept
+        -> void;
+
+    // distances inside the cell from the node to all nodes of the cell,
+    // indexed by GridGraph::nodeToIndex
+    auto searchInCell(const graph::GridCell& cell, graph::Node from) noexcept
+        -> void;
+
+    [[nodiscard]] auto getCellSide(std::size_t level) const noexcept
+        -> std::size_t;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t last_graph_version_;
+
+    // barrier state of every node the cells were last abstracted with
+    std::vector<bool> abstracted_barriers_;
+    std::size_t leaf_size_;
+    std::size_t top_depth_;
+    std::size_t leaf_depth_;
+    std::size_t root_side_;
+
+    std::vector<std::vector<AbstractCell>> levels_;
+    std::vector<std::size_t> cells_per_row_;
+    std::vector<std::vector<std::uint32_t>> entrance_indices_;
+
+    // state of searchInCell, the queue doubles as the touched list
+    std::vector<graph::Distance> cell_distances_;
+    std::vector<graph::Node> cell_queue_;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <limits>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// exact distance oracle based on a 2-hop hub labelling
+// the labels are computed with pruned landmark labelling, every label is
+// stored in one flat array and sorted by the rank of its hubs
+class HubLabelDistanceOracle
+{
+public:
+    static constexpr auto is_thread_save = true;
+
+    HubLabelDistanceOracle(const graph::GridGraph& graph) noexcept;
+    HubLabelDistanceOracle() = delete;
+    HubLabelDistanceOracle(HubLabelDistanceOracle&&) = default;
+    HubLabelDistanceOracle(const HubLabelDistanceOracle&) = default;
+    auto operator=(const HubLabelDistanceOracle&) -> HubLabelDistanceOracle& = delete;
+    auto operator=(HubLabelDistanceOracle&&) -> HubLabelDistanceOracle& = delete;
+
+    // falls back to a search on the grid while the labels are outdated
+    [[nodiscard]] auto findDistance(graph::Node from, graph::Node to) const noexcept
+        -> graph::Distance;
+
+    // false if barriers changed since the labels were computed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    // number of bytes used by the labels
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getAverageLabelSize() const noexcept
+        -> double;
+
+private:
+    using Hub = std::uint32_t;
+    static constexpr auto LABEL_END = std::numeric_limits<Hub>::max();
+
+    [[nodiscard]] auto calculateRanking() const noexcept
+        -> std::vector<graph::Node>;
+
+    auto buildLabels(const std::vector<graph::Node>& ranking) noexcept
+        -> void;
+
+    [[nodiscard]] auto intersectLabels(std::size_t first_idx,
+                                       std::size_t second_idx) const noexcept
+        -> graph::Distance;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+
+    // label of node n is stored in [label_offsets_[idx(n)], label_offsets_[idx(n) + 1])
+    // every label ends with a LABEL_END sentinel hub
+    std::vector<std::size_t> label_offsets_;
+    std::vector<Hub> label_hubs_;
+    std::vector<graph::Distance> label_distances_;
+};
+
+} // namespace pathfinding
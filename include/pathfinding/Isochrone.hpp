@@ -0,0 +1,76 @@
+#pragma once
+
+#include <graph/Node.hpp>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// all nodes within a radius around a center. The nodes are stored as a bitmap
+// over the bounding box of the radius, which is clipped to the grid, so the
+// memory depends on the radius and not on the size of the grid
+class Isochrone
+{
+public:
+    Isochrone(graph::Node top_left,
+              std::size_t height,
+              std::size_t width,
+              std::vector<bool> bitmap,
+              std::size_t number_of_nodes) noexcept;
+    Isochrone() = delete;
+    Isochrone(Isochrone&&) = default;
+    Isochrone(const Isochrone&) = default;
+    auto operator=(const Isochrone&) -> Isochrone& = default;
+    auto operator=(Isochrone&&) -> Isochrone& = default;
+
+    [[nodiscard]] auto contains(graph::Node n) const noexcept
+        -> bool;
+
+    [[nodiscard]] auto size() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto empty() const noexcept
+        -> bool;
+
+    [[nodiscard]] auto getTopLeft() const noexcept
+        -> graph::Node;
+
+    [[nodiscard]] auto getHeight() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getWidth() const noexcept
+        -> std::size_t;
+
+    // the nodes as GridGraph::nodeToIndex ids in ascending order
+    [[nodiscard]] auto toIndices(const graph::GridGraph& graph) const noexcept
+        -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto toNodes() const noexcept
+        -> std::vector<graph::Node>;
+
+private:
+    [[nodiscard]] auto isInBoundingBox(graph::Node n) const noexcept
+        -> bool;
+
+private:
+    graph::Node top_left_;
+    std::size_t height_;
+    std::size_t width_;
+    std::vector<bool> bitmap_;
+    std::size_t number_of_nodes_;
+};
+
+// all nodes whose distance to the center is at most the radius. Edges have
+// unit weight, so a breadth first search which stops after radius layers
+// finds them without a priority queue. The bitmap of the result doubles as
+// the set of visited nodes
+[[nodiscard]] auto findIsochrone(const graph::GridGraph& graph,
+                                 graph::Node center,
+                                 graph::Distance radius) noexcept
+    -> Isochrone;
+
+} // namespace pathfinding
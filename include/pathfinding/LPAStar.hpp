@@ -0,0 +1,106 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// lifelong planning A*
+// keeps the search of the last (source, target) pair alive. After barriers of
+// the graph were changed, updateNodes repairs only the part of the search which
+// is affected by the changed nodes. Changes which were not passed to
+// updateNodes are detected through the graph version and restart the search
+class LPAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    LPAStar(const graph::GridGraph& graph) noexcept;
+    LPAStar() = delete;
+    LPAStar(LPAStar&&) = default;
+    LPAStar(const LPAStar&) = default;
+    auto operator=(const LPAStar&) -> LPAStar& = delete;
+    auto operator=(LPAStar&&) -> LPAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // needs to be called with all nodes whose barrier state changed
+    // since the last query. The next query then repairs the search
+    auto updateNodes(const std::vector<graph::Node>& changed_nodes) noexcept
+        -> void;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+private:
+    // (first key, second key, node)
+    using Key = std::pair<graph::Distance, graph::Distance>;
+    using QueueEntry = std::tuple<graph::Distance, graph::Distance, graph::Node>;
+    using Queue = std::priority_queue<QueueEntry,
+                                      std::vector<QueueEntry>,
+                                      std::greater<>>;
+
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto calculateKey(graph::Node n) const noexcept
+        -> Key;
+
+    [[nodiscard]] auto estimateDistance(graph::Node n) const noexcept
+        -> graph::Distance;
+
+    auto updateNode(graph::Node n) noexcept
+        -> void;
+
+    auto computeShortestPath() noexcept
+        -> void;
+
+    [[nodiscard]] auto extractShortestPath() const noexcept
+        -> std::optional<Path>;
+
+    auto initialize(graph::Node source, graph::Node target) noexcept
+        -> void;
+
+    auto touch(std::size_t idx) noexcept
+        -> void;
+
+    // takes over the graph version if all changed nodes were repaired
+    // with their current barrier state
+    auto syncGraphVersion() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+
+    // g is the distance of the last expansion, rhs the one step lookahead
+    // a node is consistent if both values are equal
+    std::vector<graph::Distance> g_;
+    std::vector<graph::Distance> rhs_;
+    std::vector<bool> touched_flags_;
+    std::vector<std::size_t> touched_;
+    Queue pq_;
+    std::optional<graph::Node> last_source_;
+    std::optional<graph::Node> last_target_;
+    std::size_t last_graph_version_;
+
+    // barrier state of every node the search was last repaired with
+    std::vector<bool> repaired_barriers_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
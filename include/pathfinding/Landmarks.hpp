@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+enum class LandmarkStrategy {
+    FARTHEST,
+    AVOID
+};
+
+// preprocessing for ALT (A*, landmarks, triangle inequality)
+// stores the exact distances from every node to a small set of landmarks
+class Landmarks
+{
+public:
+    Landmarks(const graph::GridGraph& graph,
+              std::size_t count,
+              LandmarkStrategy strategy = LandmarkStrategy::AVOID) noexcept;
+    Landmarks() = delete;
+    Landmarks(Landmarks&&) = default;
+    Landmarks(const Landmarks&) = delete;
+    auto operator=(const Landmarks&) -> Landmarks& = delete;
+    auto operator=(Landmarks&&) -> Landmarks& = delete;
+
+    // max over all landmarks of the triangle inequality bound |d(l, to) - d(l, from)|
+    // 0 while the landmark distances are outdated
+    [[nodiscard]] auto getLowerBound(graph::Node from, graph::Node to) const noexcept
+        -> graph::Distance;
+
+    // false if barriers changed since the landmark distances were computed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    [[nodiscard]] auto getLandmarks() const noexcept
+        -> const std::vector<graph::Node>&;
+
+    // number of bytes used by the distance arrays
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+private:
+    [[nodiscard]] auto calculateDistancesFrom(graph::Node source) const noexcept
+        -> std::vector<graph::Distance>;
+
+    [[nodiscard]] auto findFarthestLandmark(const std::vector<std::vector<graph::Distance>>& landmark_distances,
+                                            graph::Node start) const noexcept
+        -> graph::Node;
+
+    [[nodiscard]] auto findAvoidLandmark(const std::vector<std::vector<graph::Distance>>& landmark_distances,
+                                         graph::Node root) const noexcept
+        -> std::optional<graph::Node>;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+    std::vector<graph::Node> landmarks_;
+
+    // distances are stored node-major, so all landmark distances
+    // of one node lie next to each other
+    std::vector<graph::Distance> distances_;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <graph/GridCell.hpp>
+#include <graph/Node.hpp>
+#include <limits>
+#include <nonstd/span.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// splits the grid into blocks of block_size x block_size nodes and stores the
+// distances between all perimeter nodes of a block, where the paths stay
+// inside the block. Blocks at the right and the bottom end of the grid are
+// padded with barriers.
+// The walkable nodes of a block are a bitmask of at most 64 bits, blocks
+// with the same bitmask share their distances, so the memory is bounded by
+// the number of distinct patterns and not by the size of the grid
+class LocalDistanceDatabase
+{
+public:
+    using Pattern = std::uint64_t;
+    using LocalDistance = std::uint8_t;
+    using LocalDistances = std::array<LocalDistance, 64>;
+
+    static constexpr auto MAX_BLOCK_SIZE = std::size_t{8};
+    static constexpr auto LOCAL_UNREACHABLE = std::numeric_limits<LocalDistance>::max();
+
+    // the block size is clamped to [2, MAX_BLOCK_SIZE]
+    LocalDistanceDatabase(const graph::GridGraph& graph,
+                          std::size_t block_size = MAX_BLOCK_SIZE) noexcept;
+    LocalDistanceDatabase() = delete;
+    LocalDistanceDatabase(LocalDistanceDatabase&&) = default;
+    LocalDistanceDatabase(const LocalDistanceDatabase&) = delete;
+    auto operator=(const LocalDistanceDatabase&) -> LocalDistanceDatabase& = delete;
+    auto operator=(LocalDistanceDatabase&&) -> LocalDistanceDatabase& = delete;
+
+    [[nodiscard]] auto getBlockSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfBlocks() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfPatterns() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getBlockOf(graph::Node n) const noexcept
+        -> std::size_t;
+
+    // the nodes of the block which are part of the grid
+    [[nodiscard]] auto getBlockCell(std::size_t block) const noexcept
+        -> graph::GridCell;
+
+    // the perimeter of a block, relative to its top left node
+    [[nodiscard]] auto getPerimeter() const noexcept
+        -> nonstd::span<const graph::Node>;
+
+    [[nodiscard]] auto getPerimeterNode(std::size_t block,
+                                        std::size_t perimeter_idx) const noexcept
+        -> graph::Node;
+
+    // index of the node in getPerimeter() if it lies on the perimeter of
+    // its block
+    [[nodiscard]] auto getPerimeterIndex(graph::Node n) const noexcept
+        -> std::optional<std::size_t>;
+
+    // distance inside the block between two of its perimeter nodes
+    [[nodiscard]] auto getLocalDistance(std::size_t block,
+                                        std::size_t from_perimeter_idx,
+                                        std::size_t to_perimeter_idx) const noexcept
+        -> graph::Distance;
+
+    // distances inside the block of the node to all nodes of its block,
+    // indexed by toLocalIndex
+    [[nodiscard]] auto findLocalDistances(graph::Node from) const noexcept
+        -> LocalDistances;
+
+    [[nodiscard]] auto toLocalIndex(graph::Node n) const noexcept
+        -> std::size_t;
+
+    // number of bytes used by the blocks and the distances of all patterns
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getGraph() const noexcept
+        -> const graph::GridGraph&;
+
+    // false if barriers changed since the patterns of the blocks were computed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+private:
+    [[nodiscard]] auto getBlockTopLeft(std::size_t block) const noexcept
+        -> graph::Node;
+
+    [[nodiscard]] auto calculatePattern(std::size_t block) const noexcept
+        -> Pattern;
+
+    [[nodiscard]] auto bfs(Pattern pattern, std::size_t from_local_idx) const noexcept
+        -> LocalDistances;
+
+    auto addPattern(Pattern pattern) noexcept
+        -> std::uint32_t;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+    std::size_t block_size_;
+    std::size_t blocks_per_row_;
+    std::size_t blocks_per_column_;
+
+    std::vector<graph::Node> perimeter_;
+    std::vector<std::optional<std::size_t>> perimeter_indices_;
+
+    std::vector<std::uint32_t> block_patterns_;
+    std::unordered_map<Pattern, std::uint32_t> pattern_ids_;
+    std::vector<Pattern> patterns_;
+
+    // the distances of pattern i are the perimeter_.size()^2 entries
+    // starting at i * perimeter_.size()^2
+    std::vector<LocalDistance> distances_;
+};
+
+} // namespace pathfinding
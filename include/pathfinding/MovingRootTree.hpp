@@ -0,0 +1,103 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// answers queries of agents which move step by step and query from their
+// position every tick.
+// A breadth first tree of a recent root, the anchor, is kept. Distances of
+// the anchor give the lower bound |d(anchor, t) - d(anchor, x)| for the
+// distance from x to t, which is exact along the shortest paths of the
+// anchor and stays tight while the source stays close to it. Queries from
+// other sources run an A* guided by this bound and the manhattan distance,
+// so a move only costs a search around the path to the target.
+// Repairing the tree itself is no option, with unit weights a move of the
+// root by one step changes the distance of every node by one.
+// The tree is rebuilt from scratch if the source is farther than
+// max_drift steps from the anchor, outside of its component or if barriers
+// changed
+class MovingRootTree
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    MovingRootTree(const graph::GridGraph& graph, std::size_t max_drift = 32) noexcept;
+    MovingRootTree() = delete;
+    MovingRootTree(MovingRootTree&&) = default;
+    MovingRootTree(const MovingRootTree&) = delete;
+    auto operator=(const MovingRootTree&) -> MovingRootTree& = delete;
+    auto operator=(MovingRootTree&&) -> MovingRootTree& = delete;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    // number of nodes expanded by the last query, queries from the anchor
+    // are answered by the tree and expand none
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+    // number of times the tree was built from scratch
+    [[nodiscard]] auto getNumberOfRebuilds() const noexcept
+        -> std::size_t;
+
+private:
+    // rebuilds the tree at the source if it can not guide searches from it
+    auto moveAnchor(graph::Node source) noexcept
+        -> void;
+
+    auto rebuild(graph::Node anchor) noexcept
+        -> void;
+
+    // A* from the source, returns the distance to the target
+    auto search(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto estimateDistance(graph::Node from, graph::Node to) const noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto getAnchorDistanceTo(graph::Node n) const noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto getDistanceTo(graph::Node n) const noexcept
+        -> graph::Distance;
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    // nodes are ordered by f, ties are broken in favour of the node which is
+    // closer to the target
+    using NodeQueue = std::priority_queue<std::tuple<graph::Distance, graph::Distance, graph::Node>,
+                                          std::vector<std::tuple<graph::Distance, graph::Distance, graph::Node>>,
+                                          std::greater<>>;
+
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    const std::size_t max_drift_;
+    std::vector<graph::Distance> anchor_distances_;
+    std::optional<graph::Node> anchor_;
+    std::size_t last_graph_version_;
+    std::size_t rebuilds_ = 0;
+
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<std::size_t> touched_;
+    NodeQueue pq_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
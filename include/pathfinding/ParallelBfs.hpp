@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <graph/Node.hpp>
+#include <nonstd/span.hpp>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// level synchronous breadth first search, the frontier of every level is
+// split between the threads. A node is claimed with a single compare and
+// swap on its distance, so no locks are needed.
+// On the unit weight grid this is delta stepping with a bucket width of one.
+// Neigbours are the ones of the neigbour calculator of the graph, so the
+// distances match the ones cached by CachingGridGraphDijkstra
+class ParallelBfs
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    // uses all available threads if number_of_threads is 0
+    ParallelBfs(const graph::GridGraph& graph,
+                std::size_t number_of_threads = 0) noexcept;
+    ParallelBfs() = delete;
+    ParallelBfs(ParallelBfs&&) = default;
+    ParallelBfs(const ParallelBfs&) = delete;
+    auto operator=(const ParallelBfs&) -> ParallelBfs& = delete;
+    auto operator=(ParallelBfs&&) -> ParallelBfs& = delete;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // distances from the source to all nodes, indexed by GridGraph::nodeToIndex
+    [[nodiscard]] auto findAllDistances(graph::Node source) noexcept
+        -> std::vector<graph::Distance>;
+
+    // the span needs to have one entry per node of the grid
+    auto findAllDistances(graph::Node source,
+                          nonstd::span<graph::Distance> distances) noexcept
+        -> void;
+
+    [[nodiscard]] auto getNumberOfThreads() const noexcept
+        -> std::size_t;
+
+private:
+    // runs the search until the target is settled or all nodes are reached
+    auto search(graph::Node source, graph::Node target) noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t number_of_threads_;
+    std::vector<std::atomic<graph::Distance>> distances_;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <graph/Node.hpp>
+#include <nonstd/span.hpp>
+#include <numeric>
+#include <pathfinding/Distance.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <utility>
+#include <vector>
+
+namespace pathfinding {
+
+// answers batches of distance queries in parallel
+// every worker thread owns its own PathFinder, so path finders which are not
+// thread save (DistanceGridGraphDijkstra, DistanceAStar, ...) can be used
+template<class PathFinder>
+class QueryEngine
+{
+public:
+    using Query = std::pair<graph::Node, graph::Node>;
+
+    QueryEngine(const graph::GridGraph& graph) noexcept
+        : path_finders_([&graph] { return PathFinder{graph}; }) {}
+
+    QueryEngine() = delete;
+    QueryEngine(QueryEngine&&) = delete;
+    QueryEngine(const QueryEngine&) = delete;
+    auto operator=(const QueryEngine&) -> QueryEngine& = delete;
+    auto operator=(QueryEngine&&) -> QueryEngine& = delete;
+
+    // results[i] is the distance of queries[i]
+    // results needs to have at least the size of queries
+    auto findDistances(nonstd::span<const Query> queries,
+                       nonstd::span<graph::Distance> results) noexcept
+        -> void
+    {
+        const auto order = calculateQueryOrder(queries);
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>{0, order.size(), GRAIN_SIZE},
+                          [&](const auto& range) {
+                              auto& path_finder = path_finders_.local();
+
+                              for(auto i = range.begin(); i < range.end(); i++) {
+                                  const auto query_idx = order[i];
+                                  const auto [source, target] = queries[query_idx];
+                                  results[query_idx] = path_finder.findDistance(source, target);
+                              }
+                          });
+    }
+
+    [[nodiscard]] auto findDistances(nonstd::span<const Query> queries) noexcept
+        -> std::vector<graph::Distance>
+    {
+        std::vector<graph::Distance> results(queries.size(), graph::UNREACHABLE);
+        findDistances(queries, nonstd::span<graph::Distance>{results});
+        return results;
+    }
+
+private:
+    // sorts the queries by the morton code of their source and then of their target.
+    // queries with the same source end up in the same worker, which lets
+    // the path finders reuse their search trees, and neighbouring queries
+    // touch the same parts of the distance arrays
+    [[nodiscard]] static auto calculateQueryOrder(nonstd::span<const Query> queries) noexcept
+        -> std::vector<std::size_t>
+    {
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> keys;
+        keys.reserve(queries.size());
+        for(const auto& [source, target] : queries) {
+            keys.emplace_back(source.zScore(), target.zScore());
+        }
+
+        std::vector<std::size_t> order(queries.size());
+        std::iota(std::begin(order), std::end(order), 0);
+
+        std::sort(std::begin(order),
+                  std::end(order),
+                  [&](auto lhs, auto rhs) {
+                      return keys[lhs] < keys[rhs];
+                  });
+
+        return order;
+    }
+
+private:
+    static constexpr std::size_t GRAIN_SIZE = 64;
+
+    tbb::enumerable_thread_specific<PathFinder> path_finders_;
+};
+
+} // namespace pathfinding
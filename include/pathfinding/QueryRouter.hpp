@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <graph/Node.hpp>
+#include <limits>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <utility>
+#include <utils/Timer.hpp>
+#include <vector>
+
+namespace pathfinding {
+
+// the ways a query can be answered by the QueryRouter
+enum class QueryRoute {
+    // source or target is a barrier or they lie in different components
+    UNREACHABLE,
+    NEIGBOURS,
+    // the rectangle spanned by source and target contains no barrier, so
+    // the manhattan distance is exact
+    FREE_RECTANGLE,
+    FALLBACK
+};
+
+struct RouteStatistics
+{
+    std::size_t number_of_queries = 0;
+    double time = 0;
+};
+
+// constant time tests which decide if a query needs a search. Barriers are
+// counted with two dimensional prefix sums and the connected components are
+// labeled, both are recomputed when the graph changed.
+// Neigbours and components always follow the manhattan neigbours
+class QueryShortcuts
+{
+public:
+    static constexpr auto NO_COMPONENT = std::numeric_limits<std::uint32_t>::max();
+
+    QueryShortcuts(const graph::GridGraph& graph) noexcept;
+    QueryShortcuts() = delete;
+    QueryShortcuts(QueryShortcuts&&) = default;
+    QueryShortcuts(const QueryShortcuts&) = default;
+    auto operator=(const QueryShortcuts&) -> QueryShortcuts& = delete;
+    auto operator=(QueryShortcuts&&) -> QueryShortcuts& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> QueryRoute;
+
+    [[nodiscard]] auto isBarrierFree(graph::Node first, graph::Node second) const noexcept
+        -> bool;
+
+    // NO_COMPONENT for barriers
+    [[nodiscard]] auto getComponent(graph::Node n) const noexcept
+        -> std::uint32_t;
+
+private:
+    auto rebuild() noexcept
+        -> void;
+
+    [[nodiscard]] auto countBarriers(std::size_t row, std::size_t column) const noexcept
+        -> std::uint32_t;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t last_graph_version_;
+
+    // barriers_[(r + 1) * (width + 1) + c + 1] is the number of barriers in
+    // the rectangle from (0, 0) to (r, c)
+    std::vector<std::uint32_t> barriers_;
+    std::vector<std::uint32_t> components_;
+};
+
+// answers the queries which QueryShortcuts can decide directly and sends all
+// other queries to its PathFinder. The number of queries and the time spent
+// is counted per route.
+// Only for graphs with manhattan neigbours
+template<class PathFinder>
+class QueryRouter
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    // the arguments after the graph are forwarded to the PathFinder
+    template<class... Args>
+    QueryRouter(const graph::GridGraph& graph, Args&&... args) noexcept
+        : shortcuts_(graph),
+          path_finder_(std::forward<Args>(args)...) {}
+
+    QueryRouter() = delete;
+    QueryRouter(QueryRouter&&) = delete;
+    QueryRouter(const QueryRouter&) = delete;
+    auto operator=(const QueryRouter&) -> QueryRouter& = delete;
+    auto operator=(QueryRouter&&) -> QueryRouter& = delete;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance
+    {
+        const utils::Timer timer;
+
+        const auto route = shortcuts_.findRoute(source, target);
+        const auto distance = [&] {
+            switch(route) {
+            case QueryRoute::UNREACHABLE:
+                return graph::UNREACHABLE;
+            case QueryRoute::NEIGBOURS:
+                return graph::Distance{1};
+            case QueryRoute::FREE_RECTANGLE:
+                return ManhattanHeuristic{}.estimateDistance(source, target);
+            default:
+                return static_cast<graph::Distance>(path_finder_.findDistance(source, target));
+            }
+        }();
+
+        auto& statistics = statistics_[static_cast<std::size_t>(route)];
+        statistics.number_of_queries++;
+        statistics.time += timer.elapsed();
+
+        return distance;
+    }
+
+    [[nodiscard]] auto getStatistics(QueryRoute route) const noexcept
+        -> const RouteStatistics&
+    {
+        return statistics_[static_cast<std::size_t>(route)];
+    }
+
+    auto resetStatistics() noexcept
+        -> void
+    {
+        statistics_.fill(RouteStatistics{});
+    }
+
+    [[nodiscard]] auto getPathFinder() noexcept
+        -> PathFinder&
+    {
+        return path_finder_;
+    }
+
+private:
+    QueryShortcuts shortcuts_;
+    PathFinder path_finder_;
+    std::array<RouteStatistics, 4> statistics_{};
+};
+
+} // namespace pathfinding
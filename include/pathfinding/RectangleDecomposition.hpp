@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// rectangle of walkable nodes, all borders are inclusive
+struct Rectangle
+{
+    std::uint32_t top;
+    std::uint32_t left;
+    std::uint32_t bottom;
+    std::uint32_t right;
+
+    [[nodiscard]] auto getWidth() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getHeight() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto isOnPerimeter(graph::Node n) const noexcept
+        -> bool;
+};
+
+// preprocessing for rectangular symmetry reduction
+// decomposes the walkable nodes into empty rectangles. Only the perimeter
+// nodes of the rectangles are needed to find shortest paths, the interior
+// of a rectangle is crossed with macro edges between opposite sides
+class RectangleDecomposition
+{
+public:
+    using RectangleId = std::uint32_t;
+    static constexpr auto NO_RECTANGLE = std::numeric_limits<RectangleId>::max();
+
+    RectangleDecomposition(const graph::GridGraph& graph) noexcept;
+    RectangleDecomposition() = delete;
+    RectangleDecomposition(RectangleDecomposition&&) = default;
+    RectangleDecomposition(const RectangleDecomposition&) = delete;
+    auto operator=(const RectangleDecomposition&) -> RectangleDecomposition& = delete;
+    auto operator=(RectangleDecomposition&&) -> RectangleDecomposition& = delete;
+
+    // the node needs to be walkable
+    [[nodiscard]] auto getRectangleOf(graph::Node n) const noexcept
+        -> const Rectangle&;
+
+    [[nodiscard]] auto getRectangleIdOf(graph::Node n) const noexcept
+        -> RectangleId;
+
+    [[nodiscard]] auto isPerimeterNode(graph::Node n) const noexcept
+        -> bool;
+
+    [[nodiscard]] auto getNumberOfRectangles() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto countPerimeterNodes() const noexcept
+        -> std::size_t;
+
+    // false if barriers changed since the grid was decomposed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+    auto toFile(std::string_view path) const noexcept
+        -> bool;
+
+private:
+    friend auto rectangleDecompositionFromFile(const graph::GridGraph& graph,
+                                               std::string_view path) noexcept
+        -> std::optional<RectangleDecomposition>;
+
+    RectangleDecomposition(const graph::GridGraph& graph,
+                           std::vector<Rectangle> rectangles) noexcept;
+
+    auto decompose() noexcept
+        -> void;
+
+    // returns false if the rectangles overlap, contain barriers
+    // or do not cover all walkable nodes
+    auto assignRectangles() noexcept
+        -> bool;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+    std::vector<Rectangle> rectangles_;
+    std::vector<RectangleId> rectangle_ids_;
+};
+
+auto rectangleDecompositionFromFile(const graph::GridGraph& graph,
+                                    std::string_view path) noexcept
+    -> std::optional<RectangleDecomposition>;
+
+} // namespace pathfinding
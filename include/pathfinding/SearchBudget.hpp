@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+
+namespace pathfinding {
+
+// limits the work of a single query, by the number of expanded nodes,
+// by a point in time or by both
+struct SearchBudget
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::optional<std::size_t> max_expansions;
+    std::optional<Clock::time_point> deadline;
+
+    [[nodiscard]] static auto fromExpansions(std::size_t max_expansions) noexcept
+        -> SearchBudget
+    {
+        return SearchBudget{max_expansions, std::nullopt};
+    }
+
+    [[nodiscard]] static auto fromTimeout(Clock::duration timeout) noexcept
+        -> SearchBudget
+    {
+        return SearchBudget{std::nullopt, Clock::now() + timeout};
+    }
+
+    [[nodiscard]] auto isExceeded(std::size_t expansions) const noexcept
+        -> bool
+    {
+        if(max_expansions and expansions >= max_expansions.value()) {
+            return true;
+        }
+
+        //reading the clock is more expensive than expanding a node
+        return deadline
+            and expansions % DEADLINE_CHECK_INTERVAL == 0
+            and Clock::now() >= deadline.value();
+    }
+
+    static constexpr std::size_t DEADLINE_CHECK_INTERVAL = 64;
+};
+
+// result of a query with a budget. If the budget was not exceeded both
+// bounds are the distance. Otherwise the distance lies between the bounds,
+// the upper bound is UNREACHABLE if no path was found yet
+struct BoundedDistance
+{
+    bool budget_exceeded;
+    graph::Distance lower_bound;
+    graph::Distance upper_bound;
+};
+
+// the path is the shortest path, or if the budget was exceeded the path to
+// the most promising node of the search frontier
+struct BoundedRoute
+{
+    BoundedDistance distance;
+    std::optional<Path> path;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <list>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// keeps the complete shortest path trees of the most recently used roots.
+// The graph is undirected, so a query can be answered by the tree of its
+// source or of its target. If neither is cached, the tree of the source is
+// computed and the least recently used tree is evicted
+class SearchTreeCache
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    SearchTreeCache(const graph::GridGraph& graph,
+                    std::size_t capacity) noexcept;
+    SearchTreeCache() = delete;
+    SearchTreeCache(SearchTreeCache&&) = default;
+    SearchTreeCache(const SearchTreeCache&) = delete;
+    auto operator=(const SearchTreeCache&) -> SearchTreeCache& = delete;
+    auto operator=(SearchTreeCache&&) -> SearchTreeCache& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto getNumberOfHits() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfMisses() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfCachedTrees() const noexcept
+        -> std::size_t;
+
+    // number of bytes used by the cached trees
+    [[nodiscard]] auto getCacheSize() const noexcept
+        -> std::size_t;
+
+    auto clear() noexcept
+        -> void;
+
+private:
+    // index of the neigbour in GridGraph::getManhattanNeigbours which is
+    // one step closer to the root, NO_MOVE for the root and unreachable nodes
+    using Move = std::uint8_t;
+    static constexpr Move NO_MOVE = 4;
+
+    struct Tree
+    {
+        graph::Node root;
+        std::vector<graph::Distance> distances;
+        std::vector<Move> moves_to_root;
+    };
+
+    // returns the tree of the source or the target and whether it is the
+    // tree of the source, computes the tree of the source on a miss
+    [[nodiscard]] auto findTree(graph::Node source, graph::Node target) noexcept
+        -> std::pair<const Tree&, bool>;
+
+    [[nodiscard]] auto computeTree(graph::Node root) const noexcept
+        -> Tree;
+
+    // all nodes from the node to the root of the tree
+    [[nodiscard]] auto walkToRoot(const Tree& tree, graph::Node from) const noexcept
+        -> std::vector<graph::Node>;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t capacity_;
+    std::size_t last_graph_version_;
+
+    // most recently used tree first
+    std::list<Tree> trees_;
+    std::unordered_map<graph::Node, std::list<Tree>::iterator> tree_lookup_;
+
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+};
+
+} // namespace pathfinding
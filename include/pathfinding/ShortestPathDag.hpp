@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// builds the dag of all shortest paths between a source and a target without
+// enumerating the paths. A breadth first search from the source is followed
+// by a backward search from the target which only visits dag nodes.
+// All edges have unit weight, so every dag node lies in the layer of its
+// distance to the source and a node is passed by every shortest path
+// (dominates the target) iff it is the only dag node of its layer
+class ShortestPathDag
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    ShortestPathDag(const graph::GridGraph& graph) noexcept;
+    ShortestPathDag() = delete;
+    ShortestPathDag(ShortestPathDag&&) = default;
+    ShortestPathDag(const ShortestPathDag&) = delete;
+    auto operator=(const ShortestPathDag&) -> ShortestPathDag& = delete;
+    auto operator=(ShortestPathDag&&) -> ShortestPathDag& = delete;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // all nodes which lie on at least one shortest path, ordered by their
+    // distance to the source. Empty if the target is not reachable
+    [[nodiscard]] auto findDagNodes(graph::Node source, graph::Node target) noexcept
+        -> std::vector<graph::Node>;
+
+    // all nodes which lie on every shortest path, ordered from the source
+    // to the target. Empty if the target is not reachable
+    [[nodiscard]] auto findDominators(graph::Node source, graph::Node target) noexcept
+        -> std::vector<graph::Node>;
+
+private:
+    // fills dag_nodes_ ordered by their distance to the target
+    auto computeDag(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    [[nodiscard]] auto getDistanceTo(graph::Node n) const noexcept
+        -> graph::Distance;
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::vector<graph::Distance> distances_;
+    std::vector<bool> in_dag_;
+    std::vector<graph::Node> touched_;
+    std::vector<graph::Node> dag_nodes_;
+};
+
+} // namespace pathfinding
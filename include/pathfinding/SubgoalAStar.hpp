@@ -0,0 +1,76 @@
+#pragma once
+
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/DijkstraQueue.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <pathfinding/SubgoalGraph.hpp>
+#include <vector>
+
+namespace pathfinding {
+
+// A* on a simple subgoal graph. Source and target are connected to their
+// directly h-reachable subgoals on the fly, the found subgoal path is
+// refined into a grid path afterwards.
+// While the subgoal graph is outdated, the queries are answered by A* on the grid
+class SubgoalAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    SubgoalAStar(const SubgoalGraph& subgoals) noexcept;
+    SubgoalAStar() = delete;
+    SubgoalAStar(SubgoalAStar&&) = default;
+    SubgoalAStar(const SubgoalAStar&) = default;
+    auto operator=(const SubgoalAStar&) -> SubgoalAStar& = delete;
+    auto operator=(SubgoalAStar&&) -> SubgoalAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+private:
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // subgoals use their id, source and target are stored behind them
+    [[nodiscard]] auto toIndex(graph::Node n,
+                               graph::Node source,
+                               graph::Node target) const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) const noexcept
+        -> std::optional<Path>;
+
+    auto reset() noexcept
+        -> void;
+
+    // created on the first query with an outdated subgoal graph
+    [[nodiscard]] auto getGridSearch() noexcept
+        -> AStar&;
+
+private:
+    const std::reference_wrapper<const SubgoalGraph> subgoals_;
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<std::size_t> touched_;
+
+    // subgoals which are directly h-reachable from the current target
+    std::vector<bool> connected_to_target_;
+    std::vector<graph::Node> target_subgoals_;
+
+    AStarQueue pq_;
+    std::optional<AStar> grid_search_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <graph/Node.hpp>
+#include <limits>
+#include <nonstd/span.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// simple subgoal graph of a 4-connected grid
+// subgoals are placed next to the convex corners of barriers, two subgoals
+// are connected if one is reachable from the other on a path with the
+// trivial distance (h-reachable) which does not pass another subgoal.
+// Every shortest path can be split into such edges
+class SubgoalGraph
+{
+public:
+    using SubgoalId = std::uint32_t;
+    static constexpr auto NO_SUBGOAL = std::numeric_limits<SubgoalId>::max();
+
+    SubgoalGraph(const graph::GridGraph& graph) noexcept;
+    SubgoalGraph() = delete;
+    SubgoalGraph(SubgoalGraph&&) = default;
+    SubgoalGraph(const SubgoalGraph&) = delete;
+    auto operator=(const SubgoalGraph&) -> SubgoalGraph& = delete;
+    auto operator=(SubgoalGraph&&) -> SubgoalGraph& = delete;
+
+    [[nodiscard]] auto isSubgoal(graph::Node n) const noexcept
+        -> bool;
+
+    [[nodiscard]] auto getSubgoalId(graph::Node n) const noexcept
+        -> SubgoalId;
+
+    [[nodiscard]] auto getSubgoal(SubgoalId id) const noexcept
+        -> graph::Node;
+
+    [[nodiscard]] auto getNeigbours(SubgoalId id) const noexcept
+        -> nonstd::span<const SubgoalId>;
+
+    // all subgoals and the target itself which are directly h-reachable
+    // from the node, the node needs to be walkable
+    [[nodiscard]] auto findDirectlyReachable(graph::Node from, graph::Node target) const noexcept
+        -> std::vector<graph::Node>;
+
+    [[nodiscard]] auto getNumberOfSubgoals() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfEdges() const noexcept
+        -> std::size_t;
+
+    // number of bytes used by the subgoals and their edges
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto getGraph() const noexcept
+        -> const graph::GridGraph&;
+
+    // false if barriers changed since the subgoals were placed
+    [[nodiscard]] auto isUpToDate() const noexcept
+        -> bool;
+
+private:
+    [[nodiscard]] auto isConvexCornerNode(graph::Node n) const noexcept
+        -> bool;
+
+    auto placeSubgoals() noexcept
+        -> void;
+
+    auto connectSubgoals() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::size_t graph_version_;
+    std::vector<SubgoalId> subgoal_ids_;
+    std::vector<graph::Node> subgoals_;
+
+    // the neigbours of subgoal i are stored in [edge_offsets_[i], edge_offsets_[i + 1])
+    std::vector<std::size_t> edge_offsets_;
+    std::vector<SubgoalId> edges_;
+};
+
+} // namespace pathfinding
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/DijkstraQueue.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Path.hpp>
+#include <pathfinding/RectangleDecomposition.hpp>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace pathfinding {
+
+// A* on the perimeter nodes of a rectangle decomposition (rectangular
+// symmetry reduction). Interior nodes are never expanded, a source or a target
+// inside of a rectangle is connected to the perimeter on the fly.
+// While the decomposition is outdated, all nodes are expanded like in A*
+class SymmetryReducedAStar
+{
+public:
+    static constexpr auto is_thread_save = false;
+
+    SymmetryReducedAStar(const graph::GridGraph& graph,
+                         const RectangleDecomposition& rectangles) noexcept;
+    SymmetryReducedAStar() = delete;
+    SymmetryReducedAStar(SymmetryReducedAStar&&) = default;
+    SymmetryReducedAStar(const SymmetryReducedAStar&) = default;
+    auto operator=(const SymmetryReducedAStar&) -> SymmetryReducedAStar& = delete;
+    auto operator=(SymmetryReducedAStar&&) -> SymmetryReducedAStar& = delete;
+
+    [[nodiscard]] auto findRoute(graph::Node source, graph::Node target) noexcept
+        -> std::optional<Path>;
+
+    [[nodiscard]] auto findDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // number of nodes which were expanded while answering the last query
+    [[nodiscard]] auto getNumberOfExpandedNodes() const noexcept
+        -> std::size_t;
+
+private:
+    [[nodiscard]] auto computeDistance(graph::Node source, graph::Node target) noexcept
+        -> graph::Distance;
+
+    // calls visit(neigbour, distance) for every edge of the reduced graph
+    template<class Visitor>
+    auto forEachSuccessor(graph::Node n,
+                          graph::Node target,
+                          Visitor visit) const noexcept
+        -> void;
+
+    // the four perimeter nodes which are reached by walking straight
+    // from a node in every direction
+    [[nodiscard]] auto getProjections(graph::Node n) const noexcept
+        -> std::array<graph::Node, 4>;
+
+    [[nodiscard]] auto extractShortestPath(graph::Node source, graph::Node target) const noexcept
+        -> std::optional<Path>;
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    const std::reference_wrapper<const RectangleDecomposition> rectangles_;
+    std::vector<graph::Distance> distances_;
+    std::vector<graph::Node> before_;
+    std::vector<graph::Node> touched_;
+    AStarQueue pq_;
+    std::size_t expanded_nodes_ = 0;
+};
+
+} // namespace pathfinding
@@ -15,6 +15,10 @@ public:
     [[nodiscard]] auto findDistance(graph::Node from, graph::Node to) const noexcept
         -> graph::Distance;
 
+    // number of bytes used by the separation lookup
+    [[nodiscard]] auto getIndexSize() const noexcept
+        -> std::size_t;
+
 private:
     [[nodiscard]] auto getIndex(graph::Node n) const noexcept
         -> std::size_t;
@@ -3,6 +3,7 @@
 #include <graph/NeigbourCalculator.hpp>
 #include <iostream>
 #include <optional>
+#include <pathfinding/Landmarks.hpp>
 #include <string>
 #include <string_view>
 
@@ -15,7 +16,17 @@ enum class NeigbourMetric {
 
 enum class RunningMode {
     SELECTION,
-    SEPARATION
+    SEPARATION,
+    LANDMARKS,
+    CPD,
+    REPLANNING,
+    RSR,
+    SUBGOALS,
+    SCALING,
+    BLOCKS,
+    HIERARCHY,
+    TUNING,
+    OCTILE
 };
 
 constexpr static inline auto PRETTY_PRINT = true;
@@ -26,7 +37,10 @@ public:
     ProgramOptions(std::string graph_file,
                    NeigbourMetric neigbour_mode,
                    RunningMode running_mode,
-                   std::optional<std::string> separation_folder = std::nullopt);
+                   std::optional<std::string> separation_folder = std::nullopt,
+                   std::size_t number_of_landmarks = 16,
+                   pathfinding::LandmarkStrategy landmark_strategy = pathfinding::LandmarkStrategy::AVOID,
+                   std::optional<std::size_t> memory_limit = std::nullopt);
 
     auto getGraphFile() const noexcept
         -> std::string_view;
@@ -34,6 +48,9 @@ public:
     auto getNeigbourCalculator() const noexcept
         -> graph::NeigbourCalculator;
 
+    auto getNeigbourMetric() const noexcept
+        -> NeigbourMetric;
+
     auto getRunningMode() const noexcept
         -> RunningMode;
 
@@ -43,11 +60,24 @@ public:
     auto getSeparationFolder() const noexcept
         -> std::string_view;
 
+    auto getNumberOfLandmarks() const noexcept
+        -> std::size_t;
+
+    auto getLandmarkStrategy() const noexcept
+        -> pathfinding::LandmarkStrategy;
+
+    // bytes the engine recommended by the tuning profile may use
+    auto getMemoryLimit() const noexcept
+        -> std::optional<std::size_t>;
+
 private:
     std::string graph_file_;
     NeigbourMetric neigbour_mode_;
     RunningMode running_mode_;
     std::optional<std::string> separation_folder_;
+    std::size_t number_of_landmarks_;
+    pathfinding::LandmarkStrategy landmark_strategy_;
+    std::optional<std::size_t> memory_limit_;
 };
 
 auto parseArguments(int argc, char* argv[])
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <separation/Separation.hpp>
+#include <string_view>
+#include <vector>
+
+namespace graph {
+class GridGraph;
+}
+
+namespace utils {
+
+// the engines which take part in the calibration
+enum class TunedEngine : std::uint64_t {
+    DIJKSTRA,
+    ASTAR,
+    SEPARATION_ORACLE
+};
+
+[[nodiscard]] auto toString(TunedEngine engine) noexcept
+    -> std::string_view;
+
+struct EngineCalibration
+{
+    TunedEngine engine;
+    double preprocessing_time;
+    // average time of one calibration query
+    double query_time;
+    // bytes of the index and of the search state after the calibration
+    std::size_t memory_usage;
+};
+
+// the measured engines of one map. It is stored in the results folder of the
+// map so later runs can pick the engine without calibrating again
+class TuningProfile
+{
+public:
+    TuningProfile(const graph::GridGraph& graph,
+                  std::vector<EngineCalibration> calibrations) noexcept;
+
+    TuningProfile() = delete;
+    TuningProfile(TuningProfile&&) = default;
+    TuningProfile(const TuningProfile&) = default;
+    auto operator=(const TuningProfile&) -> TuningProfile& = delete;
+    auto operator=(TuningProfile&&) -> TuningProfile& = delete;
+
+    // the engine with the lowest average query time among the engines which
+    // fit into the memory limit. An engine which is at most 10% slower but
+    // uses less memory is preferred. If no engine fits, the one with the
+    // lowest memory usage is returned
+    [[nodiscard]] auto getRecommendedEngine(std::optional<std::size_t> memory_limit = std::nullopt) const noexcept
+        -> TunedEngine;
+
+    [[nodiscard]] auto getCalibrations() const noexcept
+        -> const std::vector<EngineCalibration>&;
+
+    auto toFile(std::string_view path) const noexcept
+        -> bool;
+
+private:
+    const std::reference_wrapper<const graph::GridGraph> graph_;
+    std::vector<EngineCalibration> calibrations_;
+};
+
+// nullopt if the file is missing or belongs to another map
+auto tuningProfileFromFile(const graph::GridGraph& graph,
+                           std::string_view path) noexcept
+    -> std::optional<TuningProfile>;
+
+// answers the same seeded random queries with every engine, the separation
+// oracle is skipped if there are no separations
+auto calibrateEngines(const graph::GridGraph& graph,
+                      const std::vector<separation::Separation>& separations,
+                      std::size_t number_of_queries = 1000,
+                      std::uint64_t seed = 42) noexcept
+    -> TuningProfile;
+
+} // namespace utils
@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <cstdint>
 #include <fmt/core.h>
 #include <fstream>
 #include <graph/GridGraph.hpp>
 #include <graph/NeigbourCalculator.hpp>
+#include <nonstd/span.hpp>
 #include <random>
 #include <selection/NodeSelection.hpp>
 #include <vector>
@@ -153,6 +155,42 @@ auto GridGraph::isWalkableNode(Node n) const noexcept
     return grid_[index];
 }
 
+auto GridGraph::setBarrier(Node n, bool is_barrier) noexcept
+    -> bool
+{
+    if(n.row >= height_ or n.column >= width_) {
+        return false;
+    }
+
+    const auto index = n.row * width_ + n.column;
+    if(grid_[index] == is_barrier) {
+        grid_[index] = !is_barrier;
+        changes_.emplace_back(n);
+        version_++;
+    }
+
+    return true;
+}
+
+auto GridGraph::toggleBarrier(Node n) noexcept
+    -> bool
+{
+    return setBarrier(n, !isBarrier(n));
+}
+
+auto GridGraph::getVersion() const noexcept
+    -> std::size_t
+{
+    return version_;
+}
+
+auto GridGraph::getChangedNodesSince(std::size_t version) const noexcept
+    -> nonstd::span<const Node>
+{
+    const auto first = std::min(version, changes_.size());
+    return nonstd::span<const Node>{changes_}.subspan(first);
+}
+
 auto GridGraph::nodeToIndex(const graph::Node& n) const noexcept
     -> std::size_t
 {
@@ -247,6 +285,24 @@ auto GridGraph::countWalkableNodes() const noexcept
                            });
 }
 
+auto GridGraph::hashBarrierLayout() const noexcept
+    -> std::uint64_t
+{
+    //fnv-1a over the size and the indices of the walkable nodes
+    std::uint64_t hash = 0xcbf29ce484222325;
+    const auto combine = [&](std::uint64_t value) {
+        hash = (hash ^ value) * 0x100000001b3;
+    };
+
+    combine(height_);
+    combine(width_);
+    for(auto n : *this) {
+        combine(nodeToIndex(n));
+    }
+
+    return hash;
+}
+
 auto GridGraph::getWalkableNeigbours(Node n) const noexcept
     -> std::vector<Node>
 {
@@ -4,22 +4,64 @@
 #include <fmt/core.h>
 #include <fmt/ostream.h>
 #include <fmt/ranges.h>
+#include <fstream>
 #include <graph/GridGraph.hpp>
+#include <optional>
 #include <pathfinding/AStar.hpp>
+#include <pathfinding/BlockAStar.hpp>
 #include <pathfinding/CachingGridGraphDijkstra.hpp>
+#include <pathfinding/CanonicalOctileAStar.hpp>
+#include <pathfinding/CompressedPathDatabase.hpp>
+#include <pathfinding/DeadEndPockets.hpp>
 #include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/HierarchicalAStar.hpp>
+#include <pathfinding/HierarchicalGraph.hpp>
+#include <pathfinding/HubLabelDistanceOracle.hpp>
+#include <pathfinding/LPAStar.hpp>
+#include <pathfinding/LocalDistanceDatabase.hpp>
+#include <pathfinding/ParallelBfs.hpp>
+#include <pathfinding/Landmarks.hpp>
+#include <pathfinding/QueryEngine.hpp>
+#include <pathfinding/RectangleDecomposition.hpp>
+#include <pathfinding/SubgoalAStar.hpp>
+#include <pathfinding/SubgoalGraph.hpp>
+#include <pathfinding/SymmetryReducedAStar.hpp>
+#include <random>
 #include <selection/FullNodeSelectionCalculator.hpp>
 #include <selection/SelectionLookup.hpp>
 #include <separation/SeparationDistanceOracle.hpp>
 #include <separation/SeparationOptimizer.hpp>
 #include <separation/WellSeparationCalculator.hpp>
 #include <separation/WellSeparationChecker.hpp>
+#include <string>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <utils/ProgramOptions.hpp>
 #include <utils/Timer.hpp>
+#include <utils/TuningProfile.hpp>
 
 
+using pathfinding::BlockAStar;
 using pathfinding::GridGraphDijkstra;
+using pathfinding::DistanceGridGraphDijkstra;
 using pathfinding::CachingGridGraphDijkstra;
+using pathfinding::CanonicalOctileAStar;
+using pathfinding::CompressedPathDatabase;
+using pathfinding::HierarchicalAStar;
+using pathfinding::HierarchicalGraph;
+using pathfinding::HubLabelDistanceOracle;
+using pathfinding::DistanceAStar;
+using pathfinding::Landmarks;
+using pathfinding::LPAStar;
+using pathfinding::LocalDistanceDatabase;
+using pathfinding::ParallelBfs;
+using pathfinding::LandmarkHeuristic;
+using pathfinding::QueryEngine;
+using pathfinding::RectangleDecomposition;
+using pathfinding::SubgoalAStar;
+using pathfinding::SubgoalGraph;
+using pathfinding::SymmetryReducedAStar;
 using selection::FullNodeSelectionCalculator;
 namespace fs = std::filesystem;
 
@@ -94,8 +136,30 @@ auto loadSeparations(const graph::GridGraph& graph,
     return separations;
 }
 
+auto tuningProfileFile(std::string_view result_folder)
+    -> std::string
+{
+    return fmt::format("{}/tuning_profile", result_folder);
+}
+
+// the engine the tune mode recommended for this map, dijkstra if the map
+// was never tuned
+auto loadRecommendedEngine(const graph::GridGraph& graph,
+                           const utils::ProgramOptions& options,
+                           std::string_view result_folder)
+    -> utils::TunedEngine
+{
+    const auto profile = utils::tuningProfileFromFile(graph, tuningProfileFile(result_folder));
+    if(!profile) {
+        return utils::TunedEngine::DIJKSTRA;
+    }
+
+    return profile->getRecommendedEngine(options.getMemoryLimit());
+}
+
 auto runSeparation(const graph::GridGraph& graph,
                    std::vector<separation::Separation> separations,
+                   const utils::ProgramOptions& options,
                    std::string_view result_folder)
 {
     const auto optimized_distribution_file = fmt::format("{}/optimized_distribution", result_folder);
@@ -112,8 +176,62 @@ auto runSeparation(const graph::GridGraph& graph,
     //clear to save memory
     separations.clear();
 
-    GridGraphDijkstra compare{graph};
     utils::Timer t;
+    HubLabelDistanceOracle hub_labels{graph};
+    const auto hub_label_build_time = t.elapsed();
+
+    fmt::print(
+        "separation index bytes: {}\n"
+        "hub label index bytes: {}\n"
+        "hub label average label size: {}\n"
+        "hub label preprocessing time: {}\n",
+        oracle.getIndexSize(),
+        hub_labels.getIndexSize(),
+        hub_labels.getAverageLabelSize(),
+        hub_label_build_time);
+
+    std::vector<QueryEngine<DistanceGridGraphDijkstra>::Query> queries;
+    for(std::size_t i{0}; i < 50000; i++) {
+        queries.emplace_back(graph.getRandomWalkableNode(),
+                             graph.getRandomWalkableNode());
+    }
+
+    //the batch is answered by the engine the tune mode recommended
+    const auto batch_engine = loadRecommendedEngine(graph, options, result_folder);
+    std::vector<graph::Distance> batch_distances(queries.size());
+
+    t.reset();
+    switch(batch_engine) {
+    case utils::TunedEngine::DIJKSTRA: {
+        QueryEngine<DistanceGridGraphDijkstra> engine{graph};
+        engine.findDistances(queries, batch_distances);
+        break;
+    }
+    case utils::TunedEngine::ASTAR: {
+        QueryEngine<DistanceAStar> engine{graph};
+        engine.findDistances(queries, batch_distances);
+        break;
+    }
+    case utils::TunedEngine::SEPARATION_ORACLE: {
+        //the oracle only reads its lookup and can be shared by all threads
+        tbb::parallel_for(tbb::blocked_range<std::size_t>{0, queries.size()},
+                          [&](const auto& range) {
+                              for(auto i = range.begin(); i != range.end(); i++) {
+                                  const auto [from, to] = queries[i];
+                                  batch_distances[i] = oracle.findDistance(from, to);
+                              }
+                          });
+        break;
+    }
+    }
+    const auto batch_time = t.elapsed();
+
+    fmt::print("batch {} time for {} queries: {}\n",
+               utils::toString(batch_engine),
+               queries.size(),
+               batch_time);
+
+    DistanceGridGraphDijkstra compare{graph};
 
     for(std::size_t i{0}; i < 50000; i++) {
         const auto from = graph.getRandomWalkableNode();
@@ -123,17 +241,25 @@ auto runSeparation(const graph::GridGraph& graph,
         const auto oracle_dist = oracle.findDistance(from, to);
         const auto oracle_time = t.elapsed();
 
+        t.reset();
+        const auto hub_label_dist = hub_labels.findDistance(from, to);
+        const auto hub_label_time = t.elapsed();
+
         t.reset();
         const auto compare_dist = compare.findDistance(from, to);
         const auto compare_time = t.elapsed();
         fmt::print(
             "separation distance: {}\n"
+            "hub label distance: {}\n"
             "dijkstra distance: {}\n"
             "separation time: {}\n"
+            "hub label time: {}\n"
             "dijkstra time: {}\n",
             oracle_dist,
+            hub_label_dist,
             compare_dist,
             oracle_time,
+            hub_label_time,
             compare_time);
         fmt::print("----------------------------------------------\n");
     }
@@ -188,18 +314,569 @@ auto runSelection(const graph::GridGraph& graph,
     fmt::print("optimized: {}\n", optimized_total);
 }
 
+auto runLandmarks(const graph::GridGraph& graph,
+                  std::size_t number_of_landmarks,
+                  pathfinding::LandmarkStrategy strategy,
+                  std::string_view result_folder)
+{
+    utils::Timer t;
+    Landmarks landmarks{graph, number_of_landmarks, strategy};
+
+    fmt::print(
+        "landmarks: {}\n"
+        "landmark index bytes: {}\n"
+        "landmark preprocessing time: {}\n",
+        landmarks.getLandmarks().size(),
+        landmarks.getIndexSize(),
+        t.elapsed());
+
+    pathfinding::DeadEndPockets pockets{graph};
+
+    fmt::print(
+        "dead end pockets: {}\n"
+        "nodes in dead end pockets: {}\n",
+        pockets.getNumberOfPockets(),
+        pockets.countPocketNodes());
+
+    DistanceAStar manhattan{graph};
+    DistanceAStar alt{graph, LandmarkHeuristic{landmarks}};
+    DistanceAStar pruned_alt{graph, pockets, LandmarkHeuristic{landmarks}};
+
+    const auto expansion_file = fmt::format("{}/landmark_expansions", result_folder);
+    std::ofstream file{expansion_file};
+
+    std::size_t manhattan_total = 0;
+    std::size_t alt_total = 0;
+    std::size_t pruned_alt_total = 0;
+    std::size_t mismatches = 0;
+
+    for(std::size_t i{0}; i < 10000; i++) {
+        const auto from = graph.getRandomWalkableNode();
+        const auto to = graph.getRandomWalkableNode();
+
+        t.reset();
+        const auto manhattan_dist = manhattan.findDistance(from, to);
+        const auto manhattan_time = t.elapsed();
+        const auto manhattan_expanded = manhattan.getNumberOfExpandedNodes();
+
+        t.reset();
+        const auto alt_dist = alt.findDistance(from, to);
+        const auto alt_time = t.elapsed();
+        const auto alt_expanded = alt.getNumberOfExpandedNodes();
+
+        const auto pruned_alt_dist = pruned_alt.findDistance(from, to);
+        const auto pruned_alt_expanded = pruned_alt.getNumberOfExpandedNodes();
+
+        manhattan_total += manhattan_expanded;
+        alt_total += alt_expanded;
+        pruned_alt_total += pruned_alt_expanded;
+        mismatches += manhattan_dist != alt_dist;
+        mismatches += manhattan_dist != pruned_alt_dist;
+
+        file << manhattan_dist << ", "
+             << manhattan_expanded << ", "
+             << alt_expanded << ", "
+             << pruned_alt_expanded << ", "
+             << manhattan_time << ", "
+             << alt_time << "\n";
+    }
+
+    fmt::print(
+        "manhattan expanded nodes: {}\n"
+        "landmark expanded nodes: {}\n"
+        "landmark expanded nodes without dead ends: {}\n"
+        "distance mismatches: {}\n",
+        manhattan_total,
+        alt_total,
+        pruned_alt_total,
+        mismatches);
+}
+
+auto runCompressedPathDatabase(const graph::GridGraph& graph,
+                               std::string_view result_folder)
+{
+    const auto cpd_file = fmt::format("{}/cpd", result_folder);
+
+    utils::Timer t;
+    auto cpd = [&] {
+        if(auto loaded = pathfinding::compressedPathDatabaseFromFile(graph, cpd_file)) {
+            fmt::print("loaded first move tables from {}\n", cpd_file);
+            return std::move(loaded.value());
+        }
+
+        CompressedPathDatabase built{graph};
+        built.toFile(cpd_file);
+        return built;
+    }();
+    const auto preprocessing_time = t.elapsed();
+
+    fmt::print(
+        "cpd index bytes: {}\n"
+        "cpd runs: {}\n"
+        "cpd preprocessing time: {}\n",
+        cpd.getIndexSize(),
+        cpd.getNumberOfRuns(),
+        preprocessing_time);
+
+    GridGraphDijkstra compare{graph};
+
+    std::size_t mismatches = 0;
+    double cpd_total_time = 0;
+    double dijkstra_total_time = 0;
+
+    for(std::size_t i{0}; i < 10000; i++) {
+        const auto from = graph.getRandomWalkableNode();
+        const auto to = graph.getRandomWalkableNode();
+
+        t.reset();
+        const auto cpd_path = cpd.findRoute(from, to);
+        cpd_total_time += t.elapsed();
+
+        t.reset();
+        const auto compare_path = compare.findRoute(from, to);
+        dijkstra_total_time += t.elapsed();
+
+        const auto cpd_length = cpd_path ? cpd_path->getLength() : 0;
+        const auto compare_length = compare_path ? compare_path->getLength() : 0;
+        mismatches += cpd_length != compare_length;
+    }
+
+    fmt::print(
+        "cpd path extraction time: {}\n"
+        "dijkstra path time: {}\n"
+        "length mismatches: {}\n",
+        cpd_total_time,
+        dijkstra_total_time,
+        mismatches);
+}
+
+auto runReplanning(graph::GridGraph& graph)
+{
+    LPAStar lpa{graph};
+    DistanceAStar astar{graph};
+
+    const auto from = graph.getRandomWalkableNode();
+    const auto to = graph.getRandomWalkableNode();
+
+    std::size_t lpa_total = 0;
+    std::size_t astar_total = 0;
+    std::size_t mismatches = 0;
+
+    [[maybe_unused]] auto _ = lpa.findDistance(from, to);
+
+    fmt::print("initial lpa* expanded nodes: {}\n",
+               lpa.getNumberOfExpandedNodes());
+
+    //doors open and close: toggle a few random nodes of the grid per round
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<std::size_t> row_dis(0, graph.getHeight() - 1);
+    std::uniform_int_distribution<std::size_t> column_dis(0, graph.getWidth() - 1);
+
+    for(std::size_t round{0}; round < 1000; round++) {
+        std::vector<graph::Node> changed;
+        for(std::size_t i{0}; i < 10; i++) {
+            const graph::Node node{row_dis(gen), column_dis(gen)};
+            if(node != from and node != to and graph.toggleBarrier(node)) {
+                changed.emplace_back(node);
+            }
+        }
+
+        lpa.updateNodes(changed);
+
+        const auto lpa_dist = lpa.findDistance(from, to);
+        lpa_total += lpa.getNumberOfExpandedNodes();
+
+        const auto astar_dist = astar.findDistance(from, to);
+        astar_total += astar.getNumberOfExpandedNodes();
+
+        mismatches += lpa_dist != astar_dist;
+    }
+
+    fmt::print(
+        "lpa* expanded nodes: {}\n"
+        "a* expanded nodes: {}\n"
+        "distance mismatches: {}\n",
+        lpa_total,
+        astar_total,
+        mismatches);
+}
+
+// answers random queries with the engine and with A* and prints the
+// expansions, the times and the number of different distances of both
+template<class Engine, class ExpansionsGetter>
+auto compareWithAStar(const graph::GridGraph& graph,
+                      std::string_view name,
+                      Engine& engine,
+                      ExpansionsGetter get_expansions,
+                      std::string_view expanded = "nodes")
+    -> void
+{
+    DistanceAStar astar{graph};
+    utils::Timer t;
+
+    std::size_t engine_total = 0;
+    std::size_t astar_total = 0;
+    std::size_t mismatches = 0;
+    double engine_total_time = 0;
+    double astar_total_time = 0;
+
+    for(std::size_t i{0}; i < 10000; i++) {
+        const auto from = graph.getRandomWalkableNode();
+        const auto to = graph.getRandomWalkableNode();
+
+        t.reset();
+        const auto engine_dist = engine.findDistance(from, to);
+        engine_total_time += t.elapsed();
+        engine_total += get_expansions();
+
+        t.reset();
+        const auto astar_dist = astar.findDistance(from, to);
+        astar_total_time += t.elapsed();
+        astar_total += astar.getNumberOfExpandedNodes();
+
+        mismatches += engine_dist != astar_dist;
+    }
+
+    fmt::print(
+        "{0} expanded {1}: {2}\n"
+        "a* expanded nodes: {3}\n"
+        "{0} time: {4}\n"
+        "a* time: {5}\n"
+        "distance mismatches: {6}\n",
+        name,
+        expanded,
+        engine_total,
+        astar_total,
+        engine_total_time,
+        astar_total_time,
+        mismatches);
+}
+
+auto runRectangleSymmetryReduction(const graph::GridGraph& graph,
+                                   std::string_view result_folder)
+{
+    const auto rectangle_file = fmt::format("{}/rectangles", result_folder);
+
+    utils::Timer t;
+    auto rectangles = [&] {
+        if(auto loaded = pathfinding::rectangleDecompositionFromFile(graph, rectangle_file)) {
+            fmt::print("loaded rectangles from {}\n", rectangle_file);
+            return std::move(loaded.value());
+        }
+
+        RectangleDecomposition built{graph};
+        built.toFile(rectangle_file);
+        return built;
+    }();
+    const auto preprocessing_time = t.elapsed();
+
+    fmt::print(
+        "rectangles: {}\n"
+        "perimeter nodes: {}\n"
+        "rsr preprocessing time: {}\n",
+        rectangles.getNumberOfRectangles(),
+        rectangles.countPerimeterNodes(),
+        preprocessing_time);
+
+    SymmetryReducedAStar rsr{graph, rectangles};
+    compareWithAStar(graph,
+                     "rsr",
+                     rsr,
+                     [&] { return rsr.getNumberOfExpandedNodes(); });
+}
+
+auto runSubgoalGraph(const graph::GridGraph& graph)
+{
+    utils::Timer t;
+    SubgoalGraph subgoals{graph};
+    const auto preprocessing_time = t.elapsed();
+
+    fmt::print(
+        "subgoals: {}\n"
+        "subgoal edges: {}\n"
+        "subgoal index bytes: {}\n"
+        "subgoal preprocessing time: {}\n",
+        subgoals.getNumberOfSubgoals(),
+        subgoals.getNumberOfEdges(),
+        subgoals.getIndexSize(),
+        preprocessing_time);
+
+    SubgoalAStar subgoal_astar{subgoals};
+    compareWithAStar(graph,
+                     "subgoal",
+                     subgoal_astar,
+                     [&] { return subgoal_astar.getNumberOfExpandedNodes(); });
+}
+
+auto runBlockAStar(const graph::GridGraph& graph)
+{
+    utils::Timer t;
+    LocalDistanceDatabase database{graph};
+    const auto preprocessing_time = t.elapsed();
+
+    fmt::print(
+        "blocks: {}\n"
+        "block patterns: {}\n"
+        "block index bytes: {}\n"
+        "block preprocessing time: {}\n",
+        database.getNumberOfBlocks(),
+        database.getNumberOfPatterns(),
+        database.getIndexSize(),
+        preprocessing_time);
+
+    BlockAStar block_astar{database};
+    compareWithAStar(graph,
+                     "block a*",
+                     block_astar,
+                     [&] { return block_astar.getNumberOfExpandedBlocks(); },
+                     "blocks");
+}
+
+auto runHierarchicalAStar(const graph::GridGraph& graph)
+{
+    utils::Timer t;
+    HierarchicalGraph hierarchy{graph};
+    const auto preprocessing_time = t.elapsed();
+
+    fmt::print(
+        "hierarchy levels: {}\n"
+        "hierarchy index bytes: {}\n"
+        "hierarchy preprocessing time: {}\n",
+        hierarchy.getNumberOfLevels(),
+        hierarchy.getIndexSize(),
+        preprocessing_time);
+
+    HierarchicalAStar hierarchical_astar{hierarchy};
+    compareWithAStar(graph,
+                     "hierarchical a*",
+                     hierarchical_astar,
+                     [&] { return hierarchical_astar.getNumberOfExpandedNodes(); });
+}
+
+auto runAutoTuning(const graph::GridGraph& graph,
+                   const utils::ProgramOptions& options,
+                   std::string_view result_folder)
+{
+    const auto separation_folder = fmt::format("{}/seps", result_folder);
+    const auto get_separations = [&] {
+        if(options.hasSeparationFolder()) {
+            return loadSeparations(graph, options.getSeparationFolder());
+        }
+        if(fs::exists(separation_folder)) {
+            return loadSeparations(graph, separation_folder);
+        }
+
+        auto separations = calculateSeparation(graph, result_folder);
+        saveSeparations(separations, graph, result_folder);
+        return separations;
+    };
+
+    //separations are only needed to calibrate or to run the oracle
+    std::optional<std::vector<separation::Separation>> separations;
+
+    const auto profile_file = tuningProfileFile(result_folder);
+    const auto profile = [&] {
+        if(auto loaded = utils::tuningProfileFromFile(graph, profile_file)) {
+            fmt::print("loaded tuning profile from {}\n", profile_file);
+            return std::move(loaded.value());
+        }
+
+        separations = get_separations();
+        auto calibrated = utils::calibrateEngines(graph, separations.value());
+        calibrated.toFile(profile_file);
+        return calibrated;
+    }();
+
+    for(const auto& calibration : profile.getCalibrations()) {
+        fmt::print(
+            "{0} preprocessing time: {1}\n"
+            "{0} query time: {2}\n"
+            "{0} memory bytes: {3}\n",
+            utils::toString(calibration.engine),
+            calibration.preprocessing_time,
+            calibration.query_time,
+            calibration.memory_usage);
+    }
+
+    const auto engine = profile.getRecommendedEngine(options.getMemoryLimit());
+    fmt::print("recommended engine: {}\n", utils::toString(engine));
+
+    const auto run_queries = [&](auto& path_finder) {
+        std::size_t unreachable = 0;
+        double total_time = 0;
+
+        for(std::size_t i{0}; i < 10000; i++) {
+            const auto from = graph.getRandomWalkableNode();
+            const auto to = graph.getRandomWalkableNode();
+
+            utils::Timer t;
+            unreachable += path_finder.findDistance(from, to) == graph::UNREACHABLE;
+            total_time += t.elapsed();
+        }
+
+        fmt::print(
+            "{} time: {}\n"
+            "unreachable queries: {}\n",
+            utils::toString(engine),
+            total_time,
+            unreachable);
+    };
+
+    switch(engine) {
+    case utils::TunedEngine::DIJKSTRA: {
+        DistanceGridGraphDijkstra dijkstra{graph};
+        run_queries(dijkstra);
+        break;
+    }
+    case utils::TunedEngine::ASTAR: {
+        DistanceAStar astar{graph};
+        run_queries(astar);
+        break;
+    }
+    case utils::TunedEngine::SEPARATION_ORACLE: {
+        if(!separations) {
+            separations = get_separations();
+        }
+
+        const separation::SeparationDistanceOracle oracle{graph, separations.value()};
+        run_queries(oracle);
+        break;
+    }
+    }
+}
+
+auto runParallelBfsScaling(const graph::GridGraph& graph,
+                           const graph::NeigbourCalculator& neigbour_calculator,
+                           std::string_view result_folder)
+{
+    std::vector<graph::Node> sources;
+    for(std::size_t i{0}; i < 10; i++) {
+        sources.emplace_back(graph.getRandomWalkableNode());
+    }
+
+    const auto scaling_file = fmt::format("{}/bfs_scaling", result_folder);
+    std::ofstream file{scaling_file};
+
+    //one to all searches with 1, 2, 4, ... threads up to all threads
+    const auto max_threads = ParallelBfs{graph}.getNumberOfThreads();
+    std::vector<std::size_t> thread_counts;
+    for(std::size_t threads{1}; threads < max_threads; threads *= 2) {
+        thread_counts.emplace_back(threads);
+    }
+    thread_counts.emplace_back(max_threads);
+
+    std::vector<graph::Distance> distances(graph.size());
+    double single_thread_time = 0;
+
+    for(auto threads : thread_counts) {
+        ParallelBfs bfs{graph, threads};
+
+        utils::Timer t;
+        for(auto source : sources) {
+            bfs.findAllDistances(source, distances);
+        }
+        const auto time = t.elapsed();
+
+        if(threads == 1) {
+            single_thread_time = time;
+        }
+
+        fmt::print("threads: {}, one to all time: {}, speedup: {}\n",
+                   threads,
+                   time,
+                   single_thread_time / time);
+
+        file << threads << ", " << time << "\n";
+    }
+
+    //the last source is checked against dijkstra, which only knows
+    //manhattan neigbours
+    if(!std::holds_alternative<graph::ManhattanNeigbourCalculator>(neigbour_calculator)) {
+        return;
+    }
+
+    DistanceGridGraphDijkstra compare{graph};
+
+    std::size_t mismatches = 0;
+    for(std::size_t i{0}; i < 1000; i++) {
+        const auto target = graph.getRandomWalkableNode();
+        mismatches += distances[graph.nodeToIndex(target)]
+            != compare.findDistance(sources.back(), target);
+    }
+
+    fmt::print("distance mismatches: {}\n", mismatches);
+}
+
+auto runCanonicalOctile(const graph::GridGraph& graph)
+{
+    CanonicalOctileAStar astar{graph};
+
+    utils::Timer t;
+    std::size_t expanded_total = 0;
+    std::size_t unreachable = 0;
+    double total_time = 0;
+
+    for(std::size_t i{0}; i < 10000; i++) {
+        const auto from = graph.getRandomWalkableNode();
+        const auto to = graph.getRandomWalkableNode();
+
+        t.reset();
+        const auto dist = astar.findDistance(from, to);
+        total_time += t.elapsed();
+
+        expanded_total += astar.getNumberOfExpandedNodes();
+        unreachable += dist == graph::UNREACHABLE;
+    }
+
+    fmt::print(
+        "canonical octile a* expanded nodes: {}\n"
+        "canonical octile a* time: {}\n"
+        "unreachable queries: {}\n",
+        expanded_total,
+        total_time,
+        unreachable);
+}
+
+// the engines of these modes only move between manhattan neigbours and are
+// compared against searches which do the same
+auto needsManhattanNeigbours(utils::RunningMode mode) noexcept
+    -> bool
+{
+    switch(mode) {
+    case utils::RunningMode::LANDMARKS:
+    case utils::RunningMode::CPD:
+    case utils::RunningMode::REPLANNING:
+    case utils::RunningMode::RSR:
+    case utils::RunningMode::SUBGOALS:
+    case utils::RunningMode::BLOCKS:
+    case utils::RunningMode::HIERARCHY:
+        return true;
+    default:
+        return false;
+    }
+}
+
 auto main(int argc, char* argv[])
     -> int
 {
     const auto options = utils::parseArguments(argc, argv);
     const auto graph_file = options.getGraphFile();
     const auto neigbour_calculator = options.getNeigbourCalculator();
-    const auto graph = graph::parseFileToGridGraph(graph_file, neigbour_calculator).value();
     const auto running_mode = options.getRunningMode();
+
+    if(needsManhattanNeigbours(running_mode)
+       and !std::holds_alternative<graph::ManhattanNeigbourCalculator>(neigbour_calculator)) {
+        fmt::print(stderr,
+                   "the engines of this mode only support manhattan neigbours, "
+                   "use --neigbour-mode manhattan\n");
+        return 1;
+    }
+
+    auto graph = graph::parseFileToGridGraph(graph_file, neigbour_calculator).value();
     const auto graph_filename = utils::unquote(fs::path(graph_file).filename());
     const auto result_folder = fmt::format("./results/{}/", graph_filename);
 
-
     fs::create_directories(result_folder);
 
     const auto message = fmt::format("File: {}\nheight: {}\nwidth: {} |V|: {}",
@@ -237,6 +914,7 @@ auto main(int argc, char* argv[])
 
         runSeparation(graph,
                       std::move(separations),
+                      options,
                       result_folder);
         break;
     }
@@ -244,5 +922,48 @@ auto main(int argc, char* argv[])
         runSelection(graph, result_folder);
         break;
     }
+    case utils::RunningMode::LANDMARKS: {
+        runLandmarks(graph,
+                     options.getNumberOfLandmarks(),
+                     options.getLandmarkStrategy(),
+                     result_folder);
+        break;
+    }
+    case utils::RunningMode::CPD: {
+        runCompressedPathDatabase(graph, result_folder);
+        break;
+    }
+    case utils::RunningMode::REPLANNING: {
+        runReplanning(graph);
+        break;
+    }
+    case utils::RunningMode::RSR: {
+        runRectangleSymmetryReduction(graph, result_folder);
+        break;
+    }
+    case utils::RunningMode::SUBGOALS: {
+        runSubgoalGraph(graph);
+        break;
+    }
+    case utils::RunningMode::SCALING: {
+        runParallelBfsScaling(graph, neigbour_calculator, result_folder);
+        break;
+    }
+    case utils::RunningMode::BLOCKS: {
+        runBlockAStar(graph);
+        break;
+    }
+    case utils::RunningMode::HIERARCHY: {
+        runHierarchicalAStar(graph);
+        break;
+    }
+    case utils::RunningMode::TUNING: {
+        runAutoTuning(graph, options, result_folder);
+        break;
+    }
+    case utils::RunningMode::OCTILE: {
+        runCanonicalOctile(graph);
+        break;
+    }
     }
 }
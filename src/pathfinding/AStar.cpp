@@ -1,60 +1,131 @@
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <graph/GridGraph.hpp>
 #include <numeric>
 #include <optional>
 #include <pathfinding/AStar.hpp>
+#include <pathfinding/CancellationToken.hpp>
 #include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/SearchBudget.hpp>
 #include <queue>
+#include <set>
 #include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
 #include <vector>
 
 using graph::Node;
 using graph::GridGraph;
-using pathfinding::AStar;
+using pathfinding::BasicAStar;
+using pathfinding::BoundedDistance;
+using pathfinding::CancellationToken;
 using pathfinding::Path;
+using pathfinding::SearchBudget;
 using graph::Distance;
 using graph::UNREACHABLE;
+using pathfinding::SuboptimalSearch;
 
-AStar::AStar(const graph::GridGraph& graph) noexcept
+
+template<bool StorePredecessors>
+BasicAStar<StorePredecessors>::BasicAStar(const graph::GridGraph& graph,
+                                          Heuristic heuristic) noexcept
     : graph_(graph),
+      heuristic_(heuristic),
       distances_(graph.size(), UNREACHABLE),
       settled_(graph.size(), false),
       pq_(AStarQueueComparer{}),
-      before_(graph.size(), graph::NOT_REACHABLE) {}
-
-
-auto AStar::findRoute(graph::Node source, graph::Node target) noexcept
-    -> std::optional<Path>
+      last_graph_version_(graph.getVersion()),
+      before_(StorePredecessors ? graph.size() : 0, graph::NOT_REACHABLE) {}
+
+template<bool StorePredecessors>
+BasicAStar<StorePredecessors>::BasicAStar(const graph::GridGraph& graph,
+                                          const DeadEndPockets& pockets,
+                                          Heuristic heuristic) noexcept
+    : BasicAStar(graph, heuristic)
 {
-    [[maybe_unused]] auto _ = computeDistance(source, target);
-    return extractShortestPath(source, target);
+    pockets_ = pockets;
 }
 
-auto AStar::findDistance(graph::Node source, graph::Node target) noexcept
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::findDistance(graph::Node source, graph::Node target) noexcept
     -> Distance
 {
     return computeDistance(source, target);
 }
 
-auto AStar::findTrivialDistance(graph::Node source, graph::Node target) noexcept
-    -> graph::Distance
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::findDistance(graph::Node source,
+                                                 graph::Node target,
+                                                 const SearchBudget& budget) noexcept
+    -> BoundedDistance
 {
-    if(graph_.get().isBarrier(source) or graph_.get().isBarrier(target)) {
-        return UNREACHABLE;
+    budget_ = &budget;
+    budget_exceeded_ = false;
+    frontier_ = std::nullopt;
+    const auto distance = computeDistance(source, target);
+    budget_ = nullptr;
+
+    if(!budget_exceeded_) {
+        return BoundedDistance{false, distance, distance};
     }
 
-    auto source_row = source.row;
-    auto target_row = target.row;
-    auto source_column = source.column;
-    auto target_column = target.column;
+    return BoundedDistance{true,
+                           budget_lower_bound_,
+                           getDistanceTo(target)};
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::setCancellationToken(std::optional<CancellationToken> token) noexcept
+    -> void
+{
+    cancellation_token_ = std::move(token);
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::setSuboptimality(double epsilon,
+                                                     SuboptimalSearch search) noexcept
+    -> void
+{
+    epsilon_ = std::max(epsilon, 0.0);
+    suboptimal_search_ = search;
+
+    //the cached tree was built for another weight
+    last_source_ = std::nullopt;
+}
 
-    return (std::max(source_row, target_row)
-            - std::min(source_row, target_row))
-        + (std::max(source_column, target_column)
-           - std::min(source_column, target_column));
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::getSuboptimalityBound() const noexcept
+    -> double
+{
+    return suboptimality_bound_;
 }
 
-auto AStar::getDistanceTo(graph::Node n) const noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::getMemoryUsage() const noexcept
+    -> std::size_t
+{
+    using QueueEntry = std::tuple<graph::Node, Distance, Distance>;
+
+    return distances_.capacity() * sizeof(Distance)
+        + settled_.capacity() / 8
+        + touched_.capacity() * sizeof(graph::Node)
+        + before_.capacity() * sizeof(graph::Node)
+        + pq_.size() * sizeof(QueueEntry);
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::getDistanceTo(graph::Node n) const noexcept
     -> Distance
 {
     auto index = graph_.get().nodeToIndex(n);
@@ -62,14 +133,16 @@ auto AStar::getDistanceTo(graph::Node n) const noexcept
 }
 
 
-auto AStar::setDistanceTo(graph::Node n, Distance distance) noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::setDistanceTo(graph::Node n, Distance distance) noexcept
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     distances_[index] = distance;
 }
 
-auto AStar::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::extractShortestPath(graph::Node source, graph::Node target) const noexcept
     -> std::optional<Path>
 {
     //check if a path exists
@@ -77,20 +150,26 @@ auto AStar::extractShortestPath(graph::Node source, graph::Node target) const no
         return std::nullopt;
     }
 
-    Path path{std::vector{target}};
-
-    while(path.getSource() != source) {
-        const auto& last_inserted = path.getSource();
-        auto last_inserted_idx = graph_.get().nodeToIndex(last_inserted);
+    //collect the nodes from the target back to the source and reverse
+    //them once, inserting at the front of the path would be quadratic
+    std::vector<graph::Node> nodes;
+    nodes.reserve(getDistanceTo(target) + 1);
+    nodes.emplace_back(target);
 
-        path.pushFront(before_[last_inserted_idx]);
+    while(nodes.back() != source) {
+        const auto last_inserted_idx = graph_.get().nodeToIndex(nodes.back());
+        nodes.emplace_back(before_[last_inserted_idx]);
     }
 
-    return path;
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
 }
 
 
-auto AStar::reset() noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::reset() noexcept
     -> void
 {
     for(auto n : touched_) {
@@ -103,55 +182,110 @@ auto AStar::reset() noexcept
     pq_ = AStarQueue{AStarQueueComparer{}};
 }
 
-auto AStar::unSettle(graph::Node n)
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::unSettle(graph::Node n)
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     settled_[index] = false;
 }
 
-auto AStar::settle(graph::Node n) noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::settle(graph::Node n) noexcept
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     settled_[index] = true;
 }
 
-auto AStar::isSettled(graph::Node n)
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::isSettled(graph::Node n)
     -> bool
 {
     auto index = graph_.get().nodeToIndex(n);
     return settled_[index];
 }
 
-auto AStar::computeDistance(graph::Node source, graph::Node target) noexcept
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> Distance
+{
+    // dispatch the heuristic once per query and not once per node
+    return std::visit(
+        [&](const auto& heuristic) {
+            if(epsilon_ <= 0) {
+                suboptimality_bound_ = 1;
+                return search(heuristic, source, target);
+            }
+
+            if(suboptimal_search_ == SuboptimalSearch::FOCAL) {
+                return focalSearch(heuristic, source, target);
+            }
+
+            return weightedSearch(heuristic, source, target);
+        },
+        heuristic_);
+}
+
+template<bool StorePredecessors>
+template<class HeuristicPolicy>
+auto BasicAStar<StorePredecessors>::search(const HeuristicPolicy& heuristic,
+                                           graph::Node source,
+                                           graph::Node target) noexcept
     -> Distance
 {
     using graph::UNREACHABLE;
 
+    expanded_nodes_ = 0;
+
     if(graph_.get().isBarrier(source)
        or graph_.get().isBarrier(target)) {
         return UNREACHABLE;
     }
 
+    //the cached tree is outdated if barriers changed since it was computed
+    if(graph_.get().getVersion() != last_graph_version_) {
+        last_graph_version_ = graph_.get().getVersion();
+        last_source_ = std::nullopt;
+    }
+
+    updatePockets(source, target);
+
     if(source == last_source_
        && isSettled(target)) {
         return getDistanceTo(target);
     }
 
-    if(source != last_source_) {
+    //the queue is ordered by the heuristic of the last target, so it can
+    //only be reused if the target did not change
+    if(source != last_source_ or target != last_target_) {
         last_source_ = source;
+        last_target_ = target;
         reset();
-        auto trivial_distance = findTrivialDistance(source, target);
-        pq_.emplace(source, 0l, trivial_distance);
+        auto estimated_distance = heuristic.estimateDistance(source, target);
+        pq_.emplace(source, Distance{0}, estimated_distance);
         setDistanceTo(source, 0);
         touched_.emplace_back(source);
     }
 
     while(!pq_.empty()) {
+        //the tree of a cancelled search is incomplete and can not be reused
+        if(cancellation_token_ and cancellation_token_->isCancelled()) {
+            last_source_ = std::nullopt;
+            return UNREACHABLE;
+        }
+
+        //the queue is left untouched, so the next query can continue.
+        //The smallest g + h of the queue is a lower bound of the distance
+        if(budget_ and budget_->isExceeded(expanded_nodes_)) {
+            const auto [frontier, g, h] = pq_.top();
+            return stopSearch(frontier, g + h);
+        }
+
         auto [current_node, current_dist, _] = pq_.top();
 
         settle(current_node);
+        expanded_nodes_++;
 
         if(current_node == target) {
             return current_dist;
@@ -164,15 +298,15 @@ auto AStar::computeDistance(graph::Node source, graph::Node target) noexcept
         auto neigbours = graph_.get().getManhattanNeigbours(current_node);
 
         for(auto neig : neigbours) {
-            if(graph_.get().isBarrier(neig)) {
+            if(graph_.get().isBarrier(neig) or !isAllowed(neig)) {
                 continue;
             }
 
             auto neig_dist = getDistanceTo(neig);
-            auto neig_heuristic = findTrivialDistance(neig, target);
             auto new_dist = current_dist + 1;
 
             if(UNREACHABLE != current_dist and neig_dist > new_dist) {
+                auto neig_heuristic = heuristic.estimateDistance(neig, target);
                 touched_.emplace_back(neig);
                 setDistanceTo(neig, new_dist);
                 pq_.emplace(neig, new_dist, neig_heuristic);
@@ -184,10 +318,277 @@ auto AStar::computeDistance(graph::Node source, graph::Node target) noexcept
     return getDistanceTo(target);
 }
 
+template<bool StorePredecessors>
+template<class HeuristicPolicy>
+auto BasicAStar<StorePredecessors>::weightedSearch(const HeuristicPolicy& heuristic,
+                                                   graph::Node source,
+                                                   graph::Node target) noexcept
+    -> Distance
+{
+    expanded_nodes_ = 0;
+
+    if(graph_.get().isBarrier(source)
+       or graph_.get().isBarrier(target)) {
+        suboptimality_bound_ = 1;
+        return UNREACHABLE;
+    }
+
+    //the weighted estimates are not consistent, so the distances of the
+    //expanded nodes are not final and the tree can not be reused
+    last_source_ = std::nullopt;
+    reset();
+    updatePockets(source, target);
+
+    //the weighted estimates are not rounded, rounding breaks the bound.
+    //Expanded nodes are never reopened, which keeps the bound and the
+    //predecessors in line with the distances
+    const auto weight = 1 + epsilon_;
+    using WeightedEntry = std::pair<double, Node>;
+    std::priority_queue<WeightedEntry, std::vector<WeightedEntry>, std::greater<>> queue;
+
+    setDistanceTo(source, 0);
+    touched_.emplace_back(source);
+    queue.emplace(weight * heuristic.estimateDistance(source, target), source);
+
+    while(!queue.empty()) {
+        //the tree of a cancelled search is incomplete and can not be reused
+        if(cancellation_token_ and cancellation_token_->isCancelled()) {
+            return UNREACHABLE;
+        }
+
+        if(budget_ and budget_->isExceeded(expanded_nodes_)) {
+            return stopSearch(queue.top().second,
+                              heuristic.estimateDistance(source, target));
+        }
+
+        const auto current_node = queue.top().second;
+        queue.pop();
 
-auto AStar::setBefore(graph::Node n, graph::Node before) noexcept
+        if(isSettled(current_node)) {
+            continue;
+        }
+
+        settle(current_node);
+        expanded_nodes_++;
+
+        const auto current_dist = getDistanceTo(current_node);
+
+        //the unweighted estimate is a lower bound of the shortest distance
+        if(current_node == target) {
+            const auto lower_bound = heuristic.estimateDistance(source, target);
+            suboptimality_bound_ = weight;
+            if(current_dist == 0) {
+                suboptimality_bound_ = 1;
+            } else if(lower_bound > 0) {
+                suboptimality_bound_ = std::min(weight, static_cast<double>(current_dist) / lower_bound);
+            }
+            return current_dist;
+        }
+
+        for(auto neig : graph_.get().getManhattanNeigbours(current_node)) {
+            if(graph_.get().isBarrier(neig) or !isAllowed(neig) or isSettled(neig)) {
+                continue;
+            }
+
+            const auto neig_dist = getDistanceTo(neig);
+            const Distance new_dist = current_dist + 1;
+            if(neig_dist <= new_dist) {
+                continue;
+            }
+
+            if(neig_dist == UNREACHABLE) {
+                touched_.emplace_back(neig);
+            }
+
+            setDistanceTo(neig, new_dist);
+            setBefore(neig, current_node);
+            queue.emplace(new_dist + weight * heuristic.estimateDistance(neig, target), neig);
+        }
+    }
+
+    suboptimality_bound_ = 1;
+    return UNREACHABLE;
+}
+
+template<bool StorePredecessors>
+template<class HeuristicPolicy>
+auto BasicAStar<StorePredecessors>::focalSearch(const HeuristicPolicy& heuristic,
+                                                graph::Node source,
+                                                graph::Node target) noexcept
+    -> Distance
+{
+    expanded_nodes_ = 0;
+    suboptimality_bound_ = 1;
+
+    if(graph_.get().isBarrier(source)
+       or graph_.get().isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    //nodes can be expanded before their distance is final, so the
+    //tree can not be reused by the next query
+    last_source_ = std::nullopt;
+    reset();
+    updatePockets(source, target);
+
+    const auto weight = 1 + epsilon_;
+
+    //open is ordered by g + h. Focal contains all open nodes with
+    //g + h <= weight * min(g + h) and is ordered by h
+    std::set<std::pair<Distance, Node>> open;
+    std::set<std::tuple<Distance, Distance, Node>> focal;
+
+    const auto push = [&](Node n, Distance g, double focal_bound) {
+        const Distance h = heuristic.estimateDistance(n, target);
+        const Distance f = g + h;
+        open.emplace(f, n);
+        if(f <= focal_bound) {
+            focal.emplace(h, f, n);
+        }
+    };
+
+    const auto erase = [&](Node n, Distance g) {
+        const Distance h = heuristic.estimateDistance(n, target);
+        const Distance f = g + h;
+        open.erase(std::pair{f, n});
+        focal.erase(std::tuple{h, f, n});
+    };
+
+    setDistanceTo(source, 0);
+    touched_.emplace_back(source);
+    Distance min_f = heuristic.estimateDistance(source, target);
+    push(source, 0, weight * min_f);
+
+    while(!open.empty()) {
+        //the tree of a cancelled search is incomplete and can not be reused
+        if(cancellation_token_ and cancellation_token_->isCancelled()) {
+            return UNREACHABLE;
+        }
+
+        if(budget_ and budget_->isExceeded(expanded_nodes_)) {
+            return stopSearch(std::get<2>(*std::begin(focal)), min_f);
+        }
+
+        const auto focal_bound = weight * min_f;
+        const auto [current_h, current_f, current_node] = *std::begin(focal);
+        focal.erase(std::begin(focal));
+        open.erase(std::pair{current_f, current_node});
+
+        settle(current_node);
+        expanded_nodes_++;
+
+        const auto current_dist = getDistanceTo(current_node);
+
+        //min_f is a lower bound of the shortest distance
+        if(current_node == target) {
+            auto distance = current_dist;
+
+            //reopened nodes can have improved after they were used as
+            //predecessors, so the extracted path can be shorter
+            if constexpr(StorePredecessors) {
+                distance = static_cast<Distance>(extractShortestPath(source, target)->getLength());
+                setDistanceTo(target, distance);
+            }
+
+            if(min_f > 0) {
+                suboptimality_bound_ = std::min(weight, static_cast<double>(distance) / min_f);
+            }
+            return distance;
+        }
+
+        for(auto neig : graph_.get().getManhattanNeigbours(current_node)) {
+            if(graph_.get().isBarrier(neig) or !isAllowed(neig)) {
+                continue;
+            }
+
+            const auto neig_dist = getDistanceTo(neig);
+            const Distance new_dist = current_dist + 1;
+            if(neig_dist <= new_dist) {
+                continue;
+            }
+
+            //expanded nodes are reopened if a shorter path to them is found
+            if(neig_dist == UNREACHABLE) {
+                touched_.emplace_back(neig);
+            } else if(isSettled(neig)) {
+                unSettle(neig);
+            } else {
+                erase(neig, neig_dist);
+            }
+
+            setDistanceTo(neig, new_dist);
+            setBefore(neig, current_node);
+            push(neig, new_dist, focal_bound);
+        }
+
+        if(open.empty() or std::begin(open)->first <= min_f) {
+            continue;
+        }
+
+        //the minimum grew, open nodes below the new bound join focal
+        const auto new_min_f = std::begin(open)->first;
+        const auto new_focal_bound = weight * new_min_f;
+        const Distance first_outside = static_cast<Distance>(std::floor(focal_bound)) + 1;
+
+        for(auto iter = open.lower_bound(std::pair{first_outside, Node{0, 0}});
+            iter != std::end(open) and iter->first <= new_focal_bound;
+            ++iter) {
+            const auto [f, n] = *iter;
+            focal.emplace(heuristic.estimateDistance(n, target), f, n);
+        }
+
+        min_f = new_min_f;
+    }
+
+    return UNREACHABLE;
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::stopSearch(graph::Node frontier, graph::Distance lower_bound) noexcept
+    -> Distance
+{
+    budget_exceeded_ = true;
+    budget_lower_bound_ = lower_bound;
+    frontier_ = frontier;
+
+    return UNREACHABLE;
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::setBefore(graph::Node n, graph::Node before) noexcept
     -> void
 {
-    auto idx = graph_.get().nodeToIndex(n);
-    before_[idx] = before;
+    if constexpr(StorePredecessors) {
+        auto idx = graph_.get().nodeToIndex(n);
+        before_[idx] = before;
+    }
 }
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::isAllowed(graph::Node n) const noexcept
+    -> bool
+{
+    return !pockets_
+        or pockets_->get().isAllowed(n, source_pocket_, target_pocket_);
+}
+
+template<bool StorePredecessors>
+auto BasicAStar<StorePredecessors>::updatePockets(graph::Node source, graph::Node target) noexcept
+    -> void
+{
+    if(!pockets_) {
+        return;
+    }
+
+    //the cached tree only contains the pockets of the last target
+    const auto target_pocket = pockets_->get().getPocket(target);
+    if(target_pocket != target_pocket_) {
+        target_pocket_ = target_pocket;
+        last_source_ = std::nullopt;
+    }
+
+    source_pocket_ = pockets_->get().getPocket(source);
+}
+
+template class pathfinding::BasicAStar<true>;
+template class pathfinding::BasicAStar<false>;
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/BlockAStar.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/LocalDistanceDatabase.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::AStar;
+using pathfinding::BlockAStar;
+using pathfinding::LocalDistanceDatabase;
+using pathfinding::ManhattanHeuristic;
+using pathfinding::Path;
+
+
+BlockAStar::BlockAStar(const LocalDistanceDatabase& database) noexcept
+    : database_(database),
+      distances_(database.getGraph().size(), UNREACHABLE),
+      before_(database.getGraph().size(), graph::NOT_REACHABLE),
+      ingress_(database.getNumberOfBlocks(), 0),
+      target_(graph::NOT_REACHABLE),
+      target_block_(0),
+      to_target_{},
+      target_distance_(UNREACHABLE),
+      target_before_(graph::NOT_REACHABLE) {}
+
+auto BlockAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    //the local distances of an outdated pattern can cross barriers
+    if(!database_.get().isUpToDate()) {
+        expanded_blocks_ = 0;
+        return getGridSearch().findRoute(source, target);
+    }
+
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath(source, target);
+}
+
+auto BlockAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    if(!database_.get().isUpToDate()) {
+        expanded_blocks_ = 0;
+        return getGridSearch().findDistance(source, target);
+    }
+
+    return computeDistance(source, target);
+}
+
+auto BlockAStar::getNumberOfExpandedBlocks() const noexcept
+    -> std::size_t
+{
+    return expanded_blocks_;
+}
+
+auto BlockAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& database = database_.get();
+    const auto& graph = database.getGraph();
+
+    expanded_blocks_ = 0;
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    target_ = target;
+    target_block_ = database.getBlockOf(target);
+    to_target_ = database.findLocalDistances(target);
+
+    const auto source_block = database.getBlockOf(source);
+    const auto from_source = database.findLocalDistances(source);
+
+    distances_[graph.nodeToIndex(source)] = 0;
+    touched_.emplace_back(graph.nodeToIndex(source));
+
+    if(source_block == target_block_) {
+        const auto local = from_source[database.toLocalIndex(target)];
+        if(local != LocalDistanceDatabase::LOCAL_UNREACHABLE) {
+            target_distance_ = local;
+            target_before_ = source;
+        }
+    }
+
+    //the source block is expanded from the source instead of its perimeter
+    std::uint32_t egress = 0;
+    for(std::size_t i = 0; i < database.getPerimeter().size(); i++) {
+        const auto node = database.getPerimeterNode(source_block, i);
+        const auto local = from_source[database.toLocalIndex(node)];
+
+        if(local == LocalDistanceDatabase::LOCAL_UNREACHABLE) {
+            continue;
+        }
+
+        if(node == source or relax(node, local, source)) {
+            egress |= std::uint32_t{1} << i;
+        }
+    }
+
+    propagate(source_block, egress);
+
+    while(!pq_.empty()) {
+        const auto [key, _, block] = pq_.top();
+
+        if(key >= target_distance_) {
+            break;
+        }
+
+        pq_.pop();
+
+        //skip blocks which were expanded since they were queued
+        const auto ingress = ingress_[block];
+        if(ingress == 0) {
+            continue;
+        }
+
+        ingress_[block] = 0;
+        expanded_blocks_++;
+        expand(block, ingress);
+    }
+
+    return target_distance_;
+}
+
+auto BlockAStar::expand(std::size_t block, std::uint32_t ingress) noexcept
+    -> void
+{
+    const auto& database = database_.get();
+    const auto perimeter_size = database.getPerimeter().size();
+
+    std::uint32_t egress = ingress;
+    for(std::size_t to = 0; to < perimeter_size; to++) {
+        auto best = UNREACHABLE;
+        auto best_before = graph::NOT_REACHABLE;
+
+        for(std::size_t from = 0; from < perimeter_size; from++) {
+            if(!((ingress >> from) & 1) or from == to) {
+                continue;
+            }
+
+            const auto local = database.getLocalDistance(block, from, to);
+            if(local == UNREACHABLE) {
+                continue;
+            }
+
+            const auto from_node = database.getPerimeterNode(block, from);
+            const auto new_dist = getDistanceTo(from_node) + local;
+            if(new_dist < best) {
+                best = new_dist;
+                best_before = from_node;
+            }
+        }
+
+        if(best != UNREACHABLE
+           and relax(database.getPerimeterNode(block, to), best, best_before)) {
+            egress |= std::uint32_t{1} << to;
+        }
+    }
+
+    propagate(block, egress);
+}
+
+auto BlockAStar::propagate(std::size_t block, std::uint32_t egress) noexcept
+    -> void
+{
+    const auto& database = database_.get();
+    const auto& graph = database.getGraph();
+
+    for(std::size_t i = 0; i < database.getPerimeter().size(); i++) {
+        if(!((egress >> i) & 1)) {
+            continue;
+        }
+
+        const auto node = database.getPerimeterNode(block, i);
+        const auto node_dist = getDistanceTo(node);
+
+        if(block == target_block_) {
+            const auto local = to_target_[database.toLocalIndex(node)];
+            if(local != LocalDistanceDatabase::LOCAL_UNREACHABLE
+               and node_dist + local < target_distance_) {
+                target_distance_ = node_dist + local;
+                target_before_ = node;
+            }
+        }
+
+        for(auto neig : graph.getManhattanNeigbours(node)) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_block = database.getBlockOf(neig);
+            if(neig_block == block or !relax(neig, node_dist + 1, node)) {
+                continue;
+            }
+
+            if(ingress_[neig_block] == 0) {
+                touched_blocks_.emplace_back(neig_block);
+            }
+
+            ingress_[neig_block] |= std::uint32_t{1} << database.getPerimeterIndex(neig).value();
+            //the blocks are 4-connected, whatever neigbours the graph uses
+            const auto to_target = ManhattanHeuristic{}.estimateDistance(neig, target_);
+            pq_.emplace(node_dist + 1 + to_target, to_target, neig_block);
+        }
+    }
+}
+
+auto BlockAStar::relax(graph::Node n, graph::Distance distance, graph::Node before) noexcept
+    -> bool
+{
+    const auto idx = database_.get().getGraph().nodeToIndex(n);
+
+    if(distances_[idx] <= distance) {
+        return false;
+    }
+
+    if(distances_[idx] == UNREACHABLE) {
+        touched_.emplace_back(idx);
+    }
+
+    distances_[idx] = distance;
+    before_[idx] = before;
+    return true;
+}
+
+auto BlockAStar::getDistanceTo(graph::Node n) const noexcept
+    -> graph::Distance
+{
+    return distances_[database_.get().getGraph().nodeToIndex(n)];
+}
+
+auto BlockAStar::refineSegment(std::vector<graph::Node>& nodes, graph::Node target) const noexcept
+    -> void
+{
+    const auto& database = database_.get();
+    const auto& graph = database.getGraph();
+    const auto block = database.getBlockOf(target);
+    const auto to_target = database.findLocalDistances(target);
+
+    while(nodes.back() != target) {
+        const auto current = nodes.back();
+        const auto current_dist = to_target[database.toLocalIndex(current)];
+        const auto neigbours = graph.getManhattanNeigbours(current);
+
+        const auto next = std::find_if(std::begin(neigbours),
+                                       std::end(neigbours),
+                                       [&](auto neig) {
+                                           return !graph.isBarrier(neig)
+                                               and database.getBlockOf(neig) == block
+                                               and to_target[database.toLocalIndex(neig)] + 1 == current_dist;
+                                       });
+        nodes.emplace_back(*next);
+    }
+}
+
+auto BlockAStar::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+    -> std::optional<Path>
+{
+    const auto& database = database_.get();
+    const auto& graph = database.getGraph();
+
+    if(source == target) {
+        return Path{std::vector{source}};
+    }
+
+    //perimeter nodes from the target back to the source
+    std::vector<Node> reduced{target, target_before_};
+    while(reduced.back() != source) {
+        reduced.emplace_back(before_[graph.nodeToIndex(reduced.back())]);
+    }
+
+    std::reverse(std::begin(reduced),
+                 std::end(reduced));
+
+    //consecutive nodes are either neigbours in different blocks or
+    //connected by a path inside their block
+    std::vector<Node> nodes{source};
+    for(std::size_t i = 1; i < reduced.size(); i++) {
+        if(database.getBlockOf(nodes.back()) != database.getBlockOf(reduced[i])) {
+            nodes.emplace_back(reduced[i]);
+            continue;
+        }
+
+        refineSegment(nodes, reduced[i]);
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto BlockAStar::reset() noexcept
+    -> void
+{
+    for(auto idx : touched_) {
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+    }
+
+    for(auto block : touched_blocks_) {
+        ingress_[block] = 0;
+    }
+
+    touched_.clear();
+    touched_blocks_.clear();
+    target_distance_ = UNREACHABLE;
+    target_before_ = graph::NOT_REACHABLE;
+    pq_ = BlockQueue{};
+}
+
+auto BlockAStar::getGridSearch() noexcept
+    -> AStar&
+{
+    if(!grid_search_) {
+        grid_search_.emplace(database_.get().getGraph());
+    }
+
+    return grid_search_.value();
+}
@@ -5,8 +5,8 @@
 #include <optional>
 #include <pathfinding/CachingGridGraphDijkstra.hpp>
 #include <pathfinding/Distance.hpp>
+#include <pathfinding/ParallelBfs.hpp>
 #include <progresscpp/ProgressBar.hpp>
-#include <queue>
 #include <string_view>
 #include <vector>
 
@@ -18,9 +18,6 @@ using pathfinding::CachingGridGraphDijkstra;
 
 CachingGridGraphDijkstra::CachingGridGraphDijkstra(const graph::GridGraph &graph) noexcept
     : graph_(graph),
-      distances_(graph.size(), UNREACHABLE),
-      settled_(graph.size(), false),
-      pq_(DijkstraQueueComparer{}),
       cache_index_(graph.size(), 0),
       distance_cache_(graph.countWalkableNodes(),
                       std::vector(graph.countWalkableNodes(), UNREACHABLE))
@@ -36,22 +33,19 @@ CachingGridGraphDijkstra::CachingGridGraphDijkstra(const graph::GridGraph &graph
 
     progresscpp::ProgressBar bar{graph_size * graph_size, 80ul};
 
+    //every row is filled by one parallel one-to-all search
+    ParallelBfs bfs{graph};
+    std::vector<Distance> row(graph.size(), UNREACHABLE);
+
     for(auto from : graph) {
+        bfs.findAllDistances(from, row);
         for(auto to : graph) {
-            auto distance = computeDistance(from, to);
-            insertCache(from, to, distance);
+            insertCache(from, to, row[graph.nodeToIndex(to)]);
         }
         bar += graph_size;
         bar.displayIfChangedAtLeast(0.02);
     }
     bar.done();
-
-    //cleanup everything to save memory
-    distances_.clear();
-    settled_.clear();
-    pq_ = DijkstraQueue{DijkstraQueueComparer{}};
-    touched_.clear();
-    last_source_ = std::nullopt;
 }
 
 auto CachingGridGraphDijkstra::findDistance(const graph::Node &source,
@@ -94,10 +88,6 @@ auto CachingGridGraphDijkstra::queryCache(graph::Node first, graph::Node second)
 auto CachingGridGraphDijkstra::destroy() noexcept
     -> void
 {
-    distances_.clear();
-    settled_.clear();
-    touched_.clear();
-    pq_ = DijkstraQueue{DijkstraQueueComparer{}};
     cache_index_.clear();
     distance_cache_.clear();
 }
@@ -138,130 +128,6 @@ auto CachingGridGraphDijkstra::getIndex(const graph::Node &n) const noexcept
     return n.row * graph_.get().getWidth() + n.column;
 }
 
-auto CachingGridGraphDijkstra::getDistanceTo(const graph::Node &n) const noexcept
-    -> Distance
-{
-    auto index_opt = getIndex(n);
-
-    if(index_opt) {
-        return distances_[index_opt.value()];
-    }
-
-    return UNREACHABLE;
-}
-
-auto CachingGridGraphDijkstra::setDistanceTo(const graph::Node &n,
-                                    Distance distance) noexcept
-    -> void
-{
-    auto index_opt = getIndex(n);
-
-    if(index_opt) {
-        distances_[index_opt.value()] = distance;
-    }
-}
-
-auto CachingGridGraphDijkstra::reset() noexcept
-    -> void
-{
-    for(auto n : touched_) {
-        unSettle(n);
-        setDistanceTo(n, UNREACHABLE);
-    }
-    touched_.clear();
-    pq_ = DijkstraQueue{DijkstraQueueComparer{}};
-}
-
-auto CachingGridGraphDijkstra::unSettle(const graph::Node &n) noexcept
-    -> void
-{
-    auto index_opt = getIndex(n);
-
-    if(index_opt) {
-        settled_[index_opt.value()] = false;
-    }
-}
-
-auto CachingGridGraphDijkstra::settle(const graph::Node &n) noexcept
-    -> void
-{
-    auto index_opt = getIndex(n);
-
-    if(index_opt) {
-        settled_[index_opt.value()] = true;
-    }
-}
-
-auto CachingGridGraphDijkstra::isSettled(const graph::Node &n) noexcept
-    -> bool
-{
-    auto index_opt = getIndex(n);
-
-    if(index_opt) {
-        return settled_[index_opt.value()];
-    }
-
-    return false;
-}
-
-auto CachingGridGraphDijkstra::getWalkableNeigboursOf(graph::Node node) const noexcept
-    -> std::vector<Node>
-{
-    return graph_.get().getWalkableNeigbours(node);
-}
-
-auto CachingGridGraphDijkstra::computeDistance(const graph::Node &source,
-                                      const graph::Node &target) noexcept
-    -> Distance
-{
-    using graph::UNREACHABLE;
-
-    if(graph_.get().isBarrier(source) or graph_.get().isBarrier(target)) {
-        return UNREACHABLE;
-    }
-
-    if(source == last_source_ && isSettled(target)) {
-        return getDistanceTo(target);
-    }
-
-    if(source != last_source_) {
-        last_source_ = source;
-        reset();
-        pq_.emplace(source, 0l);
-        setDistanceTo(source, 0);
-        touched_.emplace_back(source);
-    }
-
-    while(!pq_.empty()) {
-        auto [current_node, current_dist] = pq_.top();
-
-        settle(current_node);
-
-        if(current_node == target) {
-            return current_dist;
-        }
-
-        // pop after the return, otherwise we loose a value
-        // when reusing the pq
-        pq_.pop();
-
-        auto neigbours = graph_.get().getWalkableNeigbours(current_node);
-
-        for(auto &&neig : neigbours) {
-            auto neig_dist = getDistanceTo(neig);
-            auto new_dist = current_dist + 1;
-
-            if(UNREACHABLE != current_dist and neig_dist > new_dist) {
-                touched_.emplace_back(neig);
-                setDistanceTo(neig, new_dist);
-                pq_.emplace(neig, new_dist);
-            }
-        }
-    }
-
-    return getDistanceTo(target);
-}
-
 auto CachingGridGraphDijkstra::getGraph() const noexcept -> const GridGraph &
 {
     return graph_.get();
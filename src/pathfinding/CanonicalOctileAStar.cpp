@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/CanonicalOctileAStar.hpp>
+#include <pathfinding/Distance.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::CanonicalOctileAStar;
+using pathfinding::Path;
+
+namespace {
+
+// the first four directions are the cardinal ones in the order of
+// GridGraph::getManhattanNeigbours, followed by the diagonal ones
+constexpr std::array<std::pair<long, long>, 8> DIRECTIONS{std::pair{0l, 1l},
+                                                          std::pair{0l, -1l},
+                                                          std::pair{-1l, 0l},
+                                                          std::pair{1l, 0l},
+                                                          std::pair{1l, 1l},
+                                                          std::pair{1l, -1l},
+                                                          std::pair{-1l, -1l},
+                                                          std::pair{-1l, 1l}};
+
+// the source is expanded in all directions
+constexpr std::uint16_t FROM_SOURCE = 1u << DIRECTIONS.size();
+
+constexpr auto isDiagonal(std::size_t direction) noexcept
+    -> bool
+{
+    return direction >= 4;
+}
+
+constexpr auto toDirection(long row_step, long column_step) noexcept
+    -> std::size_t
+{
+    for(std::size_t direction = 0; direction < DIRECTIONS.size(); direction++) {
+        if(DIRECTIONS[direction] == std::pair{row_step, column_step}) {
+            return direction;
+        }
+    }
+    return DIRECTIONS.size();
+}
+
+auto move(Node n, long row_step, long column_step) noexcept
+    -> Node
+{
+    return Node{n.row + static_cast<std::size_t>(row_step),
+                n.column + static_cast<std::size_t>(column_step)};
+}
+
+auto move(Node n, std::size_t direction) noexcept
+    -> Node
+{
+    const auto [row_step, column_step] = DIRECTIONS[direction];
+    return move(n, row_step, column_step);
+}
+
+} // namespace
+
+
+CanonicalOctileAStar::CanonicalOctileAStar(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      distances_(graph.size(), UNREACHABLE),
+      before_(graph.size(), graph::NOT_REACHABLE),
+      reached_from_(graph.size(), 0),
+      expanded_from_(graph.size(), 0),
+      pq_(AStarQueueComparer{}) {}
+
+auto CanonicalOctileAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath(source, target);
+}
+
+auto CanonicalOctileAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    return computeDistance(source, target);
+}
+
+auto CanonicalOctileAStar::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto CanonicalOctileAStar::octileDistance(graph::Node from, graph::Node to) noexcept
+    -> graph::Distance
+{
+    const auto rows = static_cast<Distance>(std::max(from.row, to.row) - std::min(from.row, to.row));
+    const auto columns = static_cast<Distance>(std::max(from.column, to.column) - std::min(from.column, to.column));
+    const auto diagonals = std::min(rows, columns);
+    const auto straights = std::max(rows, columns) - diagonals;
+
+    return DIAGONAL_COST * diagonals + CARDINAL_COST * straights;
+}
+
+auto CanonicalOctileAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    expanded_nodes_ = 0;
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    const auto source_idx = graph.nodeToIndex(source);
+    distances_[source_idx] = 0;
+    reached_from_[source_idx] = FROM_SOURCE;
+    touched_.emplace_back(source_idx);
+    pq_.emplace(source, Distance{0}, octileDistance(source, target));
+
+    while(!pq_.empty()) {
+        const auto [current, current_dist, _] = pq_.top();
+        pq_.pop();
+
+        const auto current_idx = graph.nodeToIndex(current);
+
+        //skip outdated queue entries and directions which were already expanded
+        const auto directions = static_cast<DirectionSet>(reached_from_[current_idx] & ~expanded_from_[current_idx]);
+        if(current_dist > distances_[current_idx] or directions == 0) {
+            continue;
+        }
+
+        expanded_from_[current_idx] |= directions;
+        expanded_nodes_++;
+
+        if(current == target) {
+            return current_dist;
+        }
+
+        forEachCanonicalSuccessor(
+            current,
+            directions,
+            [&](auto neig, auto direction) {
+                const auto neig_idx = graph.nodeToIndex(neig);
+                const auto direction_bit = static_cast<DirectionSet>(1u << direction);
+                const auto new_dist = current_dist
+                    + (isDiagonal(direction) ? DIAGONAL_COST : CARDINAL_COST);
+
+                if(distances_[neig_idx] > new_dist) {
+                    if(distances_[neig_idx] == UNREACHABLE) {
+                        touched_.emplace_back(neig_idx);
+                    }
+                    distances_[neig_idx] = new_dist;
+                    before_[neig_idx] = current;
+                    reached_from_[neig_idx] = direction_bit;
+                    expanded_from_[neig_idx] = 0;
+                    pq_.emplace(neig, new_dist, octileDistance(neig, target));
+                    return;
+                }
+
+                //ties reach the node from another direction, which has its
+                //own canonical successors
+                if(distances_[neig_idx] == new_dist
+                   and (reached_from_[neig_idx] & direction_bit) == 0) {
+                    reached_from_[neig_idx] |= direction_bit;
+                    pq_.emplace(neig, new_dist, octileDistance(neig, target));
+                }
+            });
+    }
+
+    return UNREACHABLE;
+}
+
+template<class Visitor>
+auto CanonicalOctileAStar::forEachCanonicalSuccessor(graph::Node n,
+                                                     DirectionSet directions,
+                                                     Visitor visit) const noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    const auto try_move = [&](auto direction) {
+        if(canMove(n, direction)) {
+            visit(move(n, direction), direction);
+        }
+    };
+
+    if(directions & FROM_SOURCE) {
+        for(std::size_t direction = 0; direction < DIRECTIONS.size(); direction++) {
+            try_move(direction);
+        }
+        return;
+    }
+
+    for(std::size_t direction = 0; direction < DIRECTIONS.size(); direction++) {
+        if((directions & (1u << direction)) == 0) {
+            continue;
+        }
+
+        const auto [row_step, column_step] = DIRECTIONS[direction];
+
+        //a diagonal move is followed by the diagonal and both of its cardinal parts
+        if(isDiagonal(direction)) {
+            try_move(direction);
+            try_move(toDirection(row_step, 0));
+            try_move(toDirection(0, column_step));
+            continue;
+        }
+
+        //a cardinal move goes straight on, unless it just passed a barrier
+        //which blocked the diagonal move from the previous node
+        try_move(direction);
+
+        for(auto side : {1l, -1l}) {
+            const auto side_row = column_step != 0 ? side : 0l;
+            const auto side_column = row_step != 0 ? side : 0l;
+            const auto parent_side = move(n, side_row - row_step, side_column - column_step);
+
+            if(graph.isBarrier(parent_side)) {
+                try_move(toDirection(side_row, side_column));
+                try_move(toDirection(row_step + side_row, column_step + side_column));
+            }
+        }
+    }
+}
+
+auto CanonicalOctileAStar::canMove(graph::Node n, std::size_t direction) const noexcept
+    -> bool
+{
+    const auto& graph = graph_.get();
+    const auto [row_step, column_step] = DIRECTIONS[direction];
+
+    if(!graph.isWalkableNode(move(n, direction))) {
+        return false;
+    }
+
+    //diagonal moves must not cut corners
+    return !isDiagonal(direction)
+        or (graph.isWalkableNode(move(n, row_step, 0))
+            and graph.isWalkableNode(move(n, 0, column_step)));
+}
+
+auto CanonicalOctileAStar::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+    -> std::optional<Path>
+{
+    const auto& graph = graph_.get();
+
+    std::vector<Node> nodes{target};
+    while(nodes.back() != source) {
+        nodes.emplace_back(before_[graph.nodeToIndex(nodes.back())]);
+    }
+
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
+}
+
+auto CanonicalOctileAStar::reset() noexcept
+    -> void
+{
+    for(auto idx : touched_) {
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+        reached_from_[idx] = 0;
+        expanded_from_[idx] = 0;
+    }
+
+    touched_.clear();
+    pq_ = AStarQueue{AStarQueueComparer{}};
+}
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <graph/Node.hpp>
+#include <optional>
+#include <pathfinding/CompactPath.hpp>
+#include <pathfinding/Path.hpp>
+#include <vector>
+
+using graph::Node;
+using pathfinding::CompactPath;
+using pathfinding::Path;
+
+namespace {
+
+//the first four directions are the manhattan ones, so they fit into 2 bits
+constexpr std::array<std::pair<std::int64_t, std::int64_t>, 8> DIRECTIONS{
+    std::pair{-1l, 0l},
+    std::pair{0l, 1l},
+    std::pair{1l, 0l},
+    std::pair{0l, -1l},
+    std::pair{-1l, 1l},
+    std::pair{1l, 1l},
+    std::pair{1l, -1l},
+    std::pair{-1l, -1l}};
+
+constexpr std::uint8_t NO_DIRECTION = DIRECTIONS.size();
+constexpr std::uint8_t FIRST_DIAGONAL_DIRECTION = 4;
+constexpr std::size_t WORD_BITS = 64;
+
+auto findDirection(Node from, Node to) noexcept
+    -> std::uint8_t
+{
+    const auto row_diff = static_cast<std::int64_t>(to.row) - static_cast<std::int64_t>(from.row);
+    const auto column_diff = static_cast<std::int64_t>(to.column) - static_cast<std::int64_t>(from.column);
+
+    for(std::uint8_t i = 0; i < DIRECTIONS.size(); i++) {
+        if(DIRECTIONS[i] == std::pair{row_diff, column_diff}) {
+            return i;
+        }
+    }
+
+    return NO_DIRECTION;
+}
+
+} // namespace
+
+
+CompactPath::CompactPath(graph::Node source) noexcept
+    : source_(source) {}
+
+auto CompactPath::getSource() const noexcept
+    -> graph::Node
+{
+    return source_;
+}
+
+auto CompactPath::getLength() const noexcept
+    -> std::size_t
+{
+    return length_;
+}
+
+auto CompactPath::getBitsPerStep() const noexcept
+    -> std::size_t
+{
+    return bits_per_step_;
+}
+
+auto CompactPath::byteSize() const noexcept
+    -> std::size_t
+{
+    return sizeof(source_)
+        + sizeof(length_)
+        + (length_ * bits_per_step_ + 7) / 8;
+}
+
+auto CompactPath::toPath() const noexcept
+    -> Path
+{
+    std::vector<Node> nodes;
+    nodes.reserve(length_ + 1);
+    nodes.emplace_back(source_);
+
+    auto current = source_;
+    for(std::size_t i = 0; i < length_; i++) {
+        const auto [row_diff, column_diff] = DIRECTIONS[getDirection(i)];
+        current = Node{current.row + row_diff,
+                       current.column + column_diff};
+        nodes.emplace_back(current);
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto CompactPath::pushBack(std::uint8_t direction) noexcept
+    -> void
+{
+    const auto bit = length_ * bits_per_step_;
+    const auto word = bit / WORD_BITS;
+    const auto offset = bit % WORD_BITS;
+
+    if(word >= steps_.size()) {
+        steps_.emplace_back(0);
+    }
+
+    steps_[word] |= static_cast<std::uint64_t>(direction) << offset;
+
+    //the code is split over two words
+    if(offset + bits_per_step_ > WORD_BITS) {
+        steps_.emplace_back(static_cast<std::uint64_t>(direction) >> (WORD_BITS - offset));
+    }
+
+    length_++;
+}
+
+auto CompactPath::getDirection(std::size_t step) const noexcept
+    -> std::uint8_t
+{
+    const auto bit = step * bits_per_step_;
+    const auto word = bit / WORD_BITS;
+    const auto offset = bit % WORD_BITS;
+    const auto mask = (std::uint64_t{1} << bits_per_step_) - 1;
+
+    auto code = steps_[word] >> offset;
+    if(offset + bits_per_step_ > WORD_BITS) {
+        code |= steps_[word + 1] << (WORD_BITS - offset);
+    }
+
+    return static_cast<std::uint8_t>(code & mask);
+}
+
+auto pathfinding::compressPath(const Path& path) noexcept
+    -> std::optional<CompactPath>
+{
+    const auto& nodes = path.getNodes();
+    if(nodes.empty()) {
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> directions;
+    directions.reserve(nodes.size() - 1);
+
+    for(std::size_t i = 1; i < nodes.size(); i++) {
+        const auto direction = findDirection(nodes[i - 1], nodes[i]);
+        if(direction == NO_DIRECTION) {
+            return std::nullopt;
+        }
+        directions.emplace_back(direction);
+    }
+
+    CompactPath compact{nodes.front()};
+
+    const auto has_diagonal_steps = std::any_of(std::cbegin(directions),
+                                                std::cend(directions),
+                                                [](auto direction) {
+                                                    return direction >= FIRST_DIAGONAL_DIRECTION;
+                                                });
+    compact.bits_per_step_ = has_diagonal_steps ? 3 : 2;
+
+    const auto bits = directions.size() * compact.bits_per_step_;
+    compact.steps_.reserve((bits + WORD_BITS - 1) / WORD_BITS);
+
+    for(auto direction : directions) {
+        compact.pushBack(direction);
+    }
+
+    return compact;
+}
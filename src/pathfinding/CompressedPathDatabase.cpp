@@ -0,0 +1,468 @@
+#include <algorithm>
+#include <cstdint>
+#include <fmt/core.h>
+#include <fstream>
+#include <graph/GridGraph.hpp>
+#include <numeric>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/CachingGridGraphDijkstra.hpp>
+#include <pathfinding/CompressedPathDatabase.hpp>
+#include <pathfinding/Distance.hpp>
+#include <progresscpp/ProgressBar.hpp>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::AStar;
+using pathfinding::CachingGridGraphDijkstra;
+using pathfinding::CompressedPathDatabase;
+using pathfinding::Path;
+
+namespace {
+
+// number of rows which are computed in parallel before they are appended
+constexpr auto ROW_BATCH_SIZE = 4096ul;
+
+constexpr std::uint64_t FILE_MAGIC = 0x3244504347524947; // "GIRGCPD2"
+
+struct FirstMoveWorkspace
+{
+    std::vector<Distance> distances;
+    std::vector<std::uint8_t> moves;
+    std::vector<std::size_t> queue;
+};
+
+template<class T>
+auto writeVector(std::ofstream& file, const std::vector<T>& vec) noexcept
+    -> void
+{
+    const std::uint64_t size = vec.size();
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(vec.data()),
+               static_cast<std::streamsize>(vec.size() * sizeof(T)));
+}
+
+// the size of a corrupt file can be arbitrary, it is checked against the
+// given maximum and the bytes left in the file before anything is allocated
+template<class T>
+auto readVector(std::ifstream& file, std::uint64_t max_size) noexcept
+    -> std::optional<std::vector<T>>
+{
+    std::uint64_t size = 0;
+    if(!file.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        return std::nullopt;
+    }
+
+    const auto position = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto bytes_left = static_cast<std::uint64_t>(file.tellg() - position);
+    file.seekg(position);
+
+    if(!file or size > max_size or size > bytes_left / sizeof(T)) {
+        return std::nullopt;
+    }
+
+    std::vector<T> vec(size);
+    if(!file.read(reinterpret_cast<char*>(vec.data()),
+                  static_cast<std::streamsize>(size * sizeof(T)))) {
+        return std::nullopt;
+    }
+
+    return vec;
+}
+
+} // namespace
+
+
+CompressedPathDatabase::CompressedPathDatabase(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      ranks_(calculateRanks())
+{
+    fmt::print("computing first move tables...\n");
+
+    tbb::enumerable_thread_specific<FirstMoveWorkspace> workspaces{
+        [&] {
+            return FirstMoveWorkspace{std::vector(graph.size(), UNREACHABLE),
+                                      std::vector(graph.size(), NO_MOVE),
+                                      {}};
+        }};
+
+    //one breadth first search per source, every node inherits the first
+    //move of the node it was discovered from
+    buildRows([&](Node source, auto& row) {
+        auto& workspace = workspaces.local();
+        const auto source_idx = graph.nodeToIndex(source);
+
+        workspace.queue.clear();
+        workspace.queue.emplace_back(source_idx);
+        workspace.distances[source_idx] = 0;
+
+        for(std::size_t head = 0; head < workspace.queue.size(); head++) {
+            const auto current_idx = workspace.queue[head];
+            const auto current = graph.indexToNode(current_idx);
+            const auto neigbours = graph.getManhattanNeigbours(current);
+
+            for(Move move = 0; move < neigbours.size(); move++) {
+                const auto neig = neigbours[move];
+                if(graph.isBarrier(neig)) {
+                    continue;
+                }
+
+                const auto neig_idx = graph.nodeToIndex(neig);
+                if(workspace.distances[neig_idx] != UNREACHABLE) {
+                    continue;
+                }
+
+                workspace.distances[neig_idx] = workspace.distances[current_idx] + 1;
+                workspace.moves[neig_idx] = current_idx == source_idx
+                    ? move
+                    : workspace.moves[current_idx];
+                workspace.queue.emplace_back(neig_idx);
+            }
+        }
+
+        for(auto idx : workspace.queue) {
+            row[ranks_[idx]] = workspace.moves[idx];
+            workspace.distances[idx] = UNREACHABLE;
+            workspace.moves[idx] = NO_MOVE;
+        }
+    });
+}
+
+CompressedPathDatabase::CompressedPathDatabase(const CachingGridGraphDijkstra& apsp) noexcept
+    : graph_(apsp.getGraph()),
+      graph_version_(apsp.getGraph().getVersion()),
+      ranks_(calculateRanks())
+{
+    fmt::print("computing first move tables from all pairs distances...\n");
+
+    const auto& graph = graph_.get();
+
+    //the first move towards a target is the first neigbour which is one
+    //step closer to the target
+    buildRows([&](Node source, auto& row) {
+        const auto neigbours = graph.getManhattanNeigbours(source);
+
+        for(auto target : graph) {
+            const auto dist = apsp.findDistance(source, target);
+            if(dist == UNREACHABLE or dist == 0) {
+                continue;
+            }
+
+            for(Move move = 0; move < neigbours.size(); move++) {
+                const auto neig = neigbours[move];
+                if(!graph.isBarrier(neig)
+                   and apsp.findDistance(neig, target) == dist - 1) {
+                    row[ranks_[graph.nodeToIndex(target)]] = move;
+                    break;
+                }
+            }
+        }
+    });
+}
+
+CompressedPathDatabase::CompressedPathDatabase(const graph::GridGraph& graph,
+                                               std::vector<Rank> ranks,
+                                               std::vector<std::size_t> row_offsets,
+                                               std::vector<Rank> run_starts,
+                                               std::vector<Move> run_moves) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      ranks_(std::move(ranks)),
+      row_offsets_(std::move(row_offsets)),
+      run_starts_(std::move(run_starts)),
+      run_moves_(std::move(run_moves)) {}
+
+auto CompressedPathDatabase::calculateRanks() const noexcept
+    -> std::vector<Rank>
+{
+    const auto& graph = graph_.get();
+
+    std::vector<Node> nodes(std::begin(graph), std::end(graph));
+    std::sort(std::begin(nodes),
+              std::end(nodes),
+              [](auto lhs, auto rhs) {
+                  return lhs.zScore() < rhs.zScore();
+              });
+
+    std::vector<Rank> ranks(graph.size(), 0);
+    for(std::size_t rank = 0; rank < nodes.size(); rank++) {
+        ranks[graph.nodeToIndex(nodes[rank])] = static_cast<Rank>(rank);
+    }
+
+    return ranks;
+}
+
+template<class RowCalculator>
+auto CompressedPathDatabase::buildRows(RowCalculator calculate_row) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    //sources are processed in rank order, so the row of rank r is the r-th row
+    std::vector<Node> sources(graph.countWalkableNodes(), Node{0, 0});
+    for(auto node : graph) {
+        sources[ranks_[graph.nodeToIndex(node)]] = node;
+    }
+
+    row_offsets_.reserve(sources.size() + 1);
+
+    progresscpp::ProgressBar bar{sources.size(), 80ul};
+
+    std::size_t processed = 0;
+    while(processed < sources.size()) {
+        const auto batch_size = std::min(ROW_BATCH_SIZE,
+                                         sources.size() - processed);
+
+        std::vector<std::vector<std::pair<Rank, Move>>> runs(batch_size);
+
+        tbb::parallel_for(std::size_t{0},
+                          batch_size,
+                          [&](auto i) {
+                              std::vector<Move> row(sources.size(), NO_MOVE);
+                              calculate_row(sources[processed + i], row);
+
+                              for(std::size_t rank = 0; rank < row.size(); rank++) {
+                                  if(rank == 0 or row[rank] != row[rank - 1]) {
+                                      runs[i].emplace_back(static_cast<Rank>(rank), row[rank]);
+                                  }
+                              }
+                          });
+
+        for(const auto& row_runs : runs) {
+            row_offsets_.emplace_back(run_starts_.size());
+            for(auto [start, move] : row_runs) {
+                run_starts_.emplace_back(start);
+                run_moves_.emplace_back(move);
+            }
+        }
+
+        processed += batch_size;
+        bar += batch_size;
+        bar.displayIfChangedAtLeast(0.02);
+    }
+    bar.done();
+
+    row_offsets_.emplace_back(run_starts_.size());
+
+    run_starts_.shrink_to_fit();
+    run_moves_.shrink_to_fit();
+}
+
+auto CompressedPathDatabase::findFirstMove(graph::Node source, graph::Node target) const noexcept
+    -> Move
+{
+    const auto& graph = graph_.get();
+    const auto source_rank = ranks_[graph.nodeToIndex(source)];
+    const auto target_rank = ranks_[graph.nodeToIndex(target)];
+
+    const auto row_begin = std::next(std::cbegin(run_starts_), row_offsets_[source_rank]);
+    const auto row_end = std::next(std::cbegin(run_starts_), row_offsets_[source_rank + 1]);
+
+    //the run containing the target is the last run starting before it
+    const auto run = std::prev(std::upper_bound(row_begin, row_end, target_rank));
+    return run_moves_[std::distance(std::cbegin(run_starts_), run)];
+}
+
+template<class Visitor>
+auto CompressedPathDatabase::followMoves(graph::Node source,
+                                         graph::Node target,
+                                         Visitor visit) const noexcept
+    -> bool
+{
+    const auto& graph = graph_.get();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return false;
+    }
+
+    auto current = source;
+    visit(current);
+
+    //a path visits every node at most once, longer walks and moves into
+    //barriers can only come from a corrupt file
+    const auto max_steps = ranks_.size();
+    for(std::size_t steps = 0; current != target; steps++) {
+        const auto move = findFirstMove(current, target);
+        if(move >= NO_MOVE or steps == max_steps) {
+            return false;
+        }
+
+        current = graph.getManhattanNeigbours(current)[move];
+        if(graph.isBarrier(current)) {
+            return false;
+        }
+
+        visit(current);
+    }
+
+    return true;
+}
+
+auto CompressedPathDatabase::findRoute(graph::Node source, graph::Node target) const noexcept
+    -> std::optional<Path>
+{
+    //the first moves of another barrier layout can lead into barriers
+    if(!isUpToDate()) {
+        return AStar{graph_.get()}.findRoute(source, target);
+    }
+
+    std::vector<Node> nodes;
+    const auto found = followMoves(source,
+                                   target,
+                                   [&](auto node) {
+                                       nodes.emplace_back(node);
+                                   });
+
+    if(!found) {
+        return std::nullopt;
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto CompressedPathDatabase::findDistance(graph::Node source, graph::Node target) const noexcept
+    -> graph::Distance
+{
+    if(!isUpToDate()) {
+        return AStar{graph_.get()}.findDistance(source, target);
+    }
+
+    Distance distance = -1;
+    const auto found = followMoves(source,
+                                   target,
+                                   [&](auto /*node*/) {
+                                       distance++;
+                                   });
+
+    return found ? distance : UNREACHABLE;
+}
+
+auto CompressedPathDatabase::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto CompressedPathDatabase::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return ranks_.size() * sizeof(Rank)
+        + row_offsets_.size() * sizeof(std::size_t)
+        + run_starts_.size() * sizeof(Rank)
+        + run_moves_.size() * sizeof(Move);
+}
+
+auto CompressedPathDatabase::getNumberOfRuns() const noexcept
+    -> std::size_t
+{
+    return run_starts_.size();
+}
+
+auto CompressedPathDatabase::toFile(std::string_view path) const noexcept
+    -> bool
+{
+    std::ofstream file{path.data(), std::ios::binary};
+
+    const std::uint64_t height = graph_.get().getHeight();
+    const std::uint64_t width = graph_.get().getWidth();
+    const std::uint64_t layout = graph_.get().hashBarrierLayout();
+
+    file.write(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&layout), sizeof(layout));
+
+    writeVector(file, ranks_);
+    writeVector(file, row_offsets_);
+    writeVector(file, run_starts_);
+    writeVector(file, run_moves_);
+
+    return !!file;
+}
+
+auto pathfinding::compressedPathDatabaseFromFile(const graph::GridGraph& graph,
+                                                 std::string_view path) noexcept
+    -> std::optional<CompressedPathDatabase>
+{
+    using Rank = CompressedPathDatabase::Rank;
+    using Move = CompressedPathDatabase::Move;
+
+    std::ifstream file{path.data(), std::ios::binary};
+
+    std::uint64_t magic = 0;
+    std::uint64_t height = 0;
+    std::uint64_t width = 0;
+    std::uint64_t layout = 0;
+
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&height), sizeof(height));
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&layout), sizeof(layout));
+
+    //the first moves of another barrier layout can lead into barriers
+    if(!file
+       or magic != FILE_MAGIC
+       or height != graph.getHeight()
+       or width != graph.getWidth()
+       or layout != graph.hashBarrierLayout()) {
+        return std::nullopt;
+    }
+
+    const auto walkable = graph.countWalkableNodes();
+    const auto max_runs = walkable * walkable;
+
+    auto ranks = readVector<Rank>(file, graph.size());
+    auto row_offsets = readVector<std::size_t>(file, walkable + 1);
+    auto run_starts = readVector<Rank>(file, max_runs);
+    auto run_moves = readVector<Move>(file, max_runs);
+
+    if(!ranks or !row_offsets or !run_starts or !run_moves
+       or ranks->size() != graph.size()
+       or row_offsets->size() != walkable + 1
+       or run_starts->size() != run_moves->size()
+       or row_offsets->front() != 0
+       or row_offsets->back() != run_starts->size()) {
+        return std::nullopt;
+    }
+
+    //queries index the rows with the ranks and search the run starts of a
+    //row, so every row needs to start with rank 0 and be sorted
+    const auto& offsets = row_offsets.value();
+    const auto& starts = run_starts.value();
+    const auto& moves = run_moves.value();
+
+    for(auto node : graph) {
+        if(ranks.value()[graph.nodeToIndex(node)] >= walkable) {
+            return std::nullopt;
+        }
+    }
+
+    for(std::size_t row = 0; row < walkable; row++) {
+        if(offsets[row] >= offsets[row + 1]
+           or offsets[row + 1] > starts.size()
+           or starts[offsets[row]] != 0) {
+            return std::nullopt;
+        }
+
+        for(auto run = offsets[row]; run < offsets[row + 1]; run++) {
+            if(starts[run] >= walkable
+               or moves[run] > CompressedPathDatabase::NO_MOVE
+               or (run > offsets[row] and starts[run] <= starts[run - 1])) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    return CompressedPathDatabase{graph,
+                                  std::move(ranks.value()),
+                                  std::move(row_offsets.value()),
+                                  std::move(run_starts.value()),
+                                  std::move(run_moves.value())};
+}
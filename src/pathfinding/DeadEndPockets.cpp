@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <fmt/core.h>
+#include <graph/GridGraph.hpp>
+#include <limits>
+#include <pathfinding/DeadEndPockets.hpp>
+#include <vector>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DeadEndPockets;
+
+namespace {
+
+constexpr auto NOT_VISITED = std::numeric_limits<std::size_t>::max();
+
+struct DfsFrame
+{
+    std::size_t idx;
+    std::size_t next_neigbour;
+};
+
+// subtree of the dfs tree, given as interval of discovery times
+struct Pocket
+{
+    std::size_t first;
+    std::size_t last;
+};
+
+} // namespace
+
+
+DeadEndPockets::DeadEndPockets(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      pockets_(graph.size(), NO_POCKET)
+{
+    fmt::print("finding dead end pockets...\n");
+    findPockets();
+}
+
+auto DeadEndPockets::getPocket(graph::Node n) const noexcept
+    -> PocketId
+{
+    return pockets_[graph_.get().nodeToIndex(n)];
+}
+
+auto DeadEndPockets::isAllowed(graph::Node n,
+                               PocketId source_pocket,
+                               PocketId target_pocket) const noexcept
+    -> bool
+{
+    //an opened barrier may connect a pocket to the outside
+    if(!isUpToDate()) {
+        return true;
+    }
+
+    const auto pocket = getPocket(n);
+    return pocket == NO_POCKET
+        or pocket == source_pocket
+        or pocket == target_pocket;
+}
+
+auto DeadEndPockets::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto DeadEndPockets::getNumberOfPockets() const noexcept
+    -> std::size_t
+{
+    return number_of_pockets_;
+}
+
+auto DeadEndPockets::countPocketNodes() const noexcept
+    -> std::size_t
+{
+    return std::count_if(std::cbegin(pockets_),
+                         std::cend(pockets_),
+                         [](auto pocket) {
+                             return pocket != NO_POCKET;
+                         });
+}
+
+auto DeadEndPockets::findPockets() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    //iterative dfs computing discovery times and low points (tarjan)
+    std::vector<std::size_t> discovery(graph.size(), NOT_VISITED);
+    std::vector<std::size_t> low(graph.size(), NOT_VISITED);
+    std::vector<std::size_t> order;
+    std::vector<Pocket> pockets;
+    std::vector<DfsFrame> stack;
+
+    for(auto root : graph) {
+        const auto root_idx = graph.nodeToIndex(root);
+        if(discovery[root_idx] != NOT_VISITED) {
+            continue;
+        }
+
+        const auto component_begin = order.size();
+        std::vector<Pocket> root_pockets;
+
+        discovery[root_idx] = low[root_idx] = order.size();
+        order.emplace_back(root_idx);
+        stack.emplace_back(DfsFrame{root_idx, 0});
+
+        while(!stack.empty()) {
+            auto& frame = stack.back();
+            const auto current = graph.indexToNode(frame.idx);
+            const auto neigbours = graph.getManhattanNeigbours(current);
+
+            if(frame.next_neigbour < neigbours.size()) {
+                const auto neig = neigbours[frame.next_neigbour++];
+                if(graph.isBarrier(neig)) {
+                    continue;
+                }
+
+                const auto neig_idx = graph.nodeToIndex(neig);
+                if(discovery[neig_idx] == NOT_VISITED) {
+                    discovery[neig_idx] = low[neig_idx] = order.size();
+                    order.emplace_back(neig_idx);
+                    stack.emplace_back(DfsFrame{neig_idx, 0});
+                } else {
+                    low[frame.idx] = std::min(low[frame.idx], discovery[neig_idx]);
+                }
+                continue;
+            }
+
+            //all neigbours are done, propagate the low point to the parent
+            const auto child_idx = frame.idx;
+            stack.pop_back();
+
+            if(stack.empty()) {
+                continue;
+            }
+
+            const auto parent_idx = stack.back().idx;
+            low[parent_idx] = std::min(low[parent_idx], low[child_idx]);
+
+            //the subtree of the child is only reachable through the parent
+            if(low[child_idx] >= discovery[parent_idx]) {
+                const auto pocket = Pocket{discovery[child_idx], order.size() - 1};
+                if(parent_idx == root_idx) {
+                    root_pockets.emplace_back(pocket);
+                } else {
+                    pockets.emplace_back(pocket);
+                }
+            }
+        }
+
+        //the root only separates its subtrees if it has more than one child
+        if(root_pockets.size() > 1) {
+            //the largest subtree is the outside, the others are dead ends
+            const auto largest = std::max_element(std::cbegin(root_pockets),
+                                                  std::cend(root_pockets),
+                                                  [](auto lhs, auto rhs) {
+                                                      return lhs.last - lhs.first < rhs.last - rhs.first;
+                                                  });
+
+            for(auto iter = std::cbegin(root_pockets); iter != std::cend(root_pockets); iter++) {
+                if(iter != largest) {
+                    pockets.emplace_back(*iter);
+                }
+            }
+        }
+
+        //a pocket which contains most of the component is the outside
+        //of the remaining part and would never be pruned
+        const auto component_size = order.size() - component_begin;
+        pockets.erase(std::remove_if(std::begin(pockets),
+                                     std::end(pockets),
+                                     [&](auto pocket) {
+                                         return pocket.first >= component_begin
+                                             and 2 * (pocket.last - pocket.first + 1) > component_size;
+                                     }),
+                      std::end(pockets));
+    }
+
+    //only the outermost pockets get an id, nested pockets are part of them
+    std::sort(std::begin(pockets),
+              std::end(pockets),
+              [](auto lhs, auto rhs) {
+                  return lhs.first < rhs.first;
+              });
+
+    std::size_t covered_until = 0;
+    bool first_pocket = true;
+    for(auto [first, last] : pockets) {
+        if(!first_pocket and first <= covered_until) {
+            continue;
+        }
+
+        first_pocket = false;
+        covered_until = last;
+        number_of_pockets_++;
+
+        for(auto i = first; i <= last; i++) {
+            pockets_[order[i]] = static_cast<PocketId>(number_of_pockets_);
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#include <graph/GridGraph.hpp>
+#include <nonstd/span.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/DistanceMatrix.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+
+namespace {
+
+// distances of one breadth first search, the queue doubles as the list of
+// touched nodes which need to be reset before the next search
+struct Sweep
+{
+    std::vector<Distance> distances;
+    std::vector<std::size_t> queue;
+};
+
+auto sweep(const GridGraph& graph,
+           Sweep& state,
+           Node root,
+           const std::vector<bool>& is_goal,
+           std::size_t number_of_goals) noexcept
+    -> void
+{
+    for(auto idx : state.queue) {
+        state.distances[idx] = UNREACHABLE;
+    }
+    state.queue.clear();
+
+    if(graph.isBarrier(root)) {
+        return;
+    }
+
+    const auto root_idx = graph.nodeToIndex(root);
+    state.distances[root_idx] = 0;
+    state.queue.emplace_back(root_idx);
+
+    for(std::size_t head = 0; head < state.queue.size(); head++) {
+        const auto current_idx = state.queue[head];
+
+        //all goals are reached, the rest of the graph is not needed
+        if(is_goal[current_idx] and --number_of_goals == 0) {
+            return;
+        }
+
+        const auto current_dist = state.distances[current_idx];
+        for(auto neig : graph.getManhattanNeigbours(graph.indexToNode(current_idx))) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(state.distances[neig_idx] == UNREACHABLE) {
+                state.distances[neig_idx] = current_dist + 1;
+                state.queue.emplace_back(neig_idx);
+            }
+        }
+    }
+}
+
+} // namespace
+
+
+auto pathfinding::distanceMatrix(const graph::GridGraph& graph,
+                                 nonstd::span<const graph::Node> sources,
+                                 nonstd::span<const graph::Node> targets,
+                                 nonstd::span<graph::Distance> results) noexcept
+    -> void
+{
+    //the graph is undirected, so the smaller side is used as roots
+    const auto sweep_targets = targets.size() < sources.size();
+    const auto roots = sweep_targets ? targets : sources;
+    const auto goals = sweep_targets ? sources : targets;
+
+    std::vector<bool> is_goal(graph.size(), false);
+    std::size_t number_of_goals = 0;
+    for(auto goal : goals) {
+        if(graph.isBarrier(goal)) {
+            continue;
+        }
+
+        const auto idx = graph.nodeToIndex(goal);
+        number_of_goals += !is_goal[idx];
+        is_goal[idx] = true;
+    }
+
+    tbb::enumerable_thread_specific<Sweep> sweeps{
+        [&graph] {
+            return Sweep{std::vector(graph.size(), UNREACHABLE), {}};
+        }};
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>{0, roots.size()},
+                      [&](const auto& range) {
+                          auto& state = sweeps.local();
+
+                          for(auto r = range.begin(); r != range.end(); r++) {
+                              sweep(graph, state, roots[r], is_goal, number_of_goals);
+
+                              for(std::size_t g = 0; g < goals.size(); g++) {
+                                  const auto distance = graph.isBarrier(goals[g])
+                                      ? UNREACHABLE
+                                      : state.distances[graph.nodeToIndex(goals[g])];
+
+                                  const auto [i, j] = sweep_targets
+                                      ? std::pair{g, r}
+                                      : std::pair{r, g};
+
+                                  results[i * targets.size() + j] = distance;
+                              }
+                          }
+                      });
+}
@@ -1,41 +1,81 @@
+#include <algorithm>
 #include <functional>
 #include <graph/GridGraph.hpp>
 #include <numeric>
 #include <optional>
+#include <pathfinding/CancellationToken.hpp>
 #include <pathfinding/GridGraphDijkstra.hpp>
 #include <pathfinding/Distance.hpp>
+#include <pathfinding/SearchBudget.hpp>
 #include <queue>
 #include <string_view>
 #include <vector>
 
 using graph::Node;
 using graph::GridGraph;
-using pathfinding::GridGraphDijkstra;
+using pathfinding::BasicGridGraphDijkstra;
+using pathfinding::BoundedDistance;
+using pathfinding::CancellationToken;
 using pathfinding::Path;
+using pathfinding::SearchBudget;
 using graph::Distance;
 using graph::UNREACHABLE;
 
-GridGraphDijkstra::GridGraphDijkstra(const graph::GridGraph& graph) noexcept
+template<bool StorePredecessors>
+BasicGridGraphDijkstra<StorePredecessors>::BasicGridGraphDijkstra(const graph::GridGraph& graph) noexcept
     : graph_(graph),
       distances_(graph.size(), UNREACHABLE),
       settled_(graph.size(), false),
       pq_(DijkstraQueueComparer{}),
-      before_(graph.size(), graph::NOT_REACHABLE) {}
+      last_graph_version_(graph.getVersion()),
+      before_(StorePredecessors ? graph.size() : 0, graph::NOT_REACHABLE) {}
 
-auto GridGraphDijkstra::findRoute(graph::Node source, graph::Node target) noexcept
-    -> std::optional<Path>
+template<bool StorePredecessors>
+BasicGridGraphDijkstra<StorePredecessors>::BasicGridGraphDijkstra(const graph::GridGraph& graph,
+                                                                  const DeadEndPockets& pockets) noexcept
+    : BasicGridGraphDijkstra(graph)
 {
-    [[maybe_unused]] auto _ = computeDistance(source, target);
-    return extractShortestPath(source, target);
+    pockets_ = pockets;
 }
 
-auto GridGraphDijkstra::findDistance(graph::Node source, graph::Node target) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::findDistance(graph::Node source, graph::Node target) noexcept
     -> Distance
 {
     return computeDistance(source, target);
 }
 
-auto GridGraphDijkstra::findTrivialDistance(graph::Node source, graph::Node target) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::findDistance(graph::Node source,
+                                                             graph::Node target,
+                                                             const SearchBudget& budget) noexcept
+    -> BoundedDistance
+{
+    budget_ = &budget;
+    budget_exceeded_ = false;
+    const auto distance = computeDistance(source, target);
+    budget_ = nullptr;
+
+    if(!budget_exceeded_) {
+        return BoundedDistance{false, distance, distance};
+    }
+
+    //the search stopped before taking the top of the queue, so all nodes
+    //closer to the source than the top are settled
+    return BoundedDistance{true,
+                           pq_.top().second,
+                           getDistanceTo(target)};
+}
+
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::setCancellationToken(std::optional<CancellationToken> token) noexcept
+    -> void
+{
+    cancellation_token_ = std::move(token);
+}
+
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::findTrivialDistance(graph::Node source, graph::Node target) noexcept
     -> graph::Distance
 {
     if(graph_.get().isBarrier(source) or graph_.get().isBarrier(target)) {
@@ -53,7 +93,21 @@ auto GridGraphDijkstra::findTrivialDistance(graph::Node source, graph::Node targ
            - std::min(source_column, target_column));
 }
 
-auto GridGraphDijkstra::getDistanceTo(graph::Node n) const noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::getMemoryUsage() const noexcept
+    -> std::size_t
+{
+    using QueueEntry = std::pair<graph::Node, Distance>;
+
+    return distances_.capacity() * sizeof(Distance)
+        + settled_.capacity() / 8
+        + touched_.capacity() * sizeof(graph::Node)
+        + before_.capacity() * sizeof(graph::Node)
+        + pq_.size() * sizeof(QueueEntry);
+}
+
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::getDistanceTo(graph::Node n) const noexcept
     -> Distance
 {
     auto index = graph_.get().nodeToIndex(n);
@@ -61,14 +115,16 @@ auto GridGraphDijkstra::getDistanceTo(graph::Node n) const noexcept
 }
 
 
-auto GridGraphDijkstra::setDistanceTo(graph::Node n, Distance distance) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::setDistanceTo(graph::Node n, Distance distance) noexcept
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     distances_[index] = distance;
 }
 
-auto GridGraphDijkstra::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::extractShortestPath(graph::Node source, graph::Node target) const noexcept
     -> std::optional<Path>
 {
     //check if a path exists
@@ -76,20 +132,26 @@ auto GridGraphDijkstra::extractShortestPath(graph::Node source, graph::Node targ
         return std::nullopt;
     }
 
-    Path path{std::vector{target}};
+    //collect the nodes from the target back to the source and reverse
+    //them once, inserting at the front of the path would be quadratic
+    std::vector<graph::Node> nodes;
+    nodes.reserve(getDistanceTo(target) + 1);
+    nodes.emplace_back(target);
 
-    while(path.getSource() != source) {
-        const auto& last_inserted = path.getSource();
-        auto last_inserted_idx = graph_.get().nodeToIndex(last_inserted);
-
-        path.pushFront(before_[last_inserted_idx]);
+    while(nodes.back() != source) {
+        const auto last_inserted_idx = graph_.get().nodeToIndex(nodes.back());
+        nodes.emplace_back(before_[last_inserted_idx]);
     }
 
-    return path;
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
 }
 
 
-auto GridGraphDijkstra::reset() noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::reset() noexcept
     -> void
 {
     for(auto n : touched_) {
@@ -102,28 +164,32 @@ auto GridGraphDijkstra::reset() noexcept
     pq_ = DijkstraQueue{DijkstraQueueComparer{}};
 }
 
-auto GridGraphDijkstra::unSettle(graph::Node n)
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::unSettle(graph::Node n)
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     settled_[index] = false;
 }
 
-auto GridGraphDijkstra::settle(graph::Node n) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::settle(graph::Node n) noexcept
     -> void
 {
     auto index = graph_.get().nodeToIndex(n);
     settled_[index] = true;
 }
 
-auto GridGraphDijkstra::isSettled(graph::Node n)
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::isSettled(graph::Node n)
     -> bool
 {
     auto index = graph_.get().nodeToIndex(n);
     return settled_[index];
 }
 
-auto GridGraphDijkstra::computeDistance(graph::Node source, graph::Node target) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::computeDistance(graph::Node source, graph::Node target) noexcept
     -> Distance
 {
     using graph::UNREACHABLE;
@@ -133,6 +199,14 @@ auto GridGraphDijkstra::computeDistance(graph::Node source, graph::Node target)
         return UNREACHABLE;
     }
 
+    //the cached tree is outdated if barriers changed since it was computed
+    if(graph_.get().getVersion() != last_graph_version_) {
+        last_graph_version_ = graph_.get().getVersion();
+        last_source_ = std::nullopt;
+    }
+
+    updatePockets(source, target);
+
     if(source == last_source_
        && isSettled(target)) {
         return getDistanceTo(target);
@@ -141,12 +215,25 @@ auto GridGraphDijkstra::computeDistance(graph::Node source, graph::Node target)
     if(source != last_source_) {
         last_source_ = source;
         reset();
-        pq_.emplace(source, 0l);
+        pq_.emplace(source, Distance{0});
         setDistanceTo(source, 0);
         touched_.emplace_back(source);
     }
 
+    std::size_t expansions = 0;
     while(!pq_.empty()) {
+        //the tree of a cancelled search is incomplete and can not be reused
+        if(cancellation_token_ and cancellation_token_->isCancelled()) {
+            last_source_ = std::nullopt;
+            return UNREACHABLE;
+        }
+
+        //the queue is left untouched, so the next query can continue
+        if(budget_ and budget_->isExceeded(expansions++)) {
+            budget_exceeded_ = true;
+            return UNREACHABLE;
+        }
+
         auto [current_node, current_dist] = pq_.top();
 
         settle(current_node);
@@ -162,6 +249,9 @@ auto GridGraphDijkstra::computeDistance(graph::Node source, graph::Node target)
         auto neigbours = graph_.get().getNeigboursOf(current_node);
 
         for(auto [neig, distance] : neigbours) {
+            if(!isAllowed(neig)) {
+                continue;
+            }
 
             auto neig_dist = getDistanceTo(neig);
             auto new_dist = current_dist + distance;
@@ -178,9 +268,41 @@ auto GridGraphDijkstra::computeDistance(graph::Node source, graph::Node target)
     return getDistanceTo(target);
 }
 
-auto GridGraphDijkstra::setBefore(graph::Node n, graph::Node before) noexcept
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::setBefore(graph::Node n, graph::Node before) noexcept
     -> void
 {
-    auto idx = graph_.get().nodeToIndex(n);
-    before_[idx] = before;
+    if constexpr(StorePredecessors) {
+        auto idx = graph_.get().nodeToIndex(n);
+        before_[idx] = before;
+    }
+}
+
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::isAllowed(graph::Node n) const noexcept
+    -> bool
+{
+    return !pockets_
+        or pockets_->get().isAllowed(n, source_pocket_, target_pocket_);
 }
+
+template<bool StorePredecessors>
+auto BasicGridGraphDijkstra<StorePredecessors>::updatePockets(graph::Node source, graph::Node target) noexcept
+    -> void
+{
+    if(!pockets_) {
+        return;
+    }
+
+    //the cached tree only contains the pockets of the last target
+    const auto target_pocket = pockets_->get().getPocket(target);
+    if(target_pocket != target_pocket_) {
+        target_pocket_ = target_pocket;
+        last_source_ = std::nullopt;
+    }
+
+    source_pocket_ = pockets_->get().getPocket(source);
+}
+
+template class pathfinding::BasicGridGraphDijkstra<true>;
+template class pathfinding::BasicGridGraphDijkstra<false>;
@@ -0,0 +1,33 @@
+#include <graph/Node.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/Landmarks.hpp>
+
+using pathfinding::LandmarkHeuristic;
+using pathfinding::ManhattanHeuristic;
+
+auto ManhattanHeuristic::estimateDistance(const graph::Node& from, const graph::Node& to) const noexcept
+    -> graph::Distance
+{
+    auto source_row = from.row;
+    auto target_row = to.row;
+    auto source_column = from.column;
+    auto target_column = to.column;
+
+    return (std::max(source_row, target_row)
+            - std::min(source_row, target_row))
+        + (std::max(source_column, target_column)
+           - std::min(source_column, target_column));
+}
+
+LandmarkHeuristic::LandmarkHeuristic(const Landmarks& landmarks) noexcept
+    : landmarks_(landmarks) {}
+
+auto LandmarkHeuristic::estimateDistance(const graph::Node& from, const graph::Node& to) const noexcept
+    -> graph::Distance
+{
+    const auto manhattan = ManhattanHeuristic{}.estimateDistance(from, to);
+    const auto landmark_bound = landmarks_.get().getLowerBound(from, to);
+
+    return std::max(manhattan, landmark_bound);
+}
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <graph/GridCell.hpp>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/HierarchicalAStar.hpp>
+#include <pathfinding/HierarchicalGraph.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridCell;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::HierarchicalAStar;
+using pathfinding::HierarchicalGraph;
+using pathfinding::ManhattanHeuristic;
+using pathfinding::Path;
+
+
+HierarchicalAStar::HierarchicalAStar(const HierarchicalGraph& hierarchy) noexcept
+    : hierarchy_(hierarchy),
+      distances_(hierarchy.getGraph().size(), UNREACHABLE),
+      before_(hierarchy.getGraph().size(), graph::NOT_REACHABLE),
+      refine_distances_(hierarchy.getGraph().size(), UNREACHABLE),
+      pq_(AStarQueueComparer{}) {}
+
+auto HierarchicalAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath(source, target);
+}
+
+auto HierarchicalAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    return computeDistance(source, target);
+}
+
+auto HierarchicalAStar::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto HierarchicalAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& hierarchy = hierarchy_.get();
+    const auto& graph = hierarchy.getGraph();
+
+    expanded_nodes_ = 0;
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    //the cached distances of an outdated hierarchy can be wrong, the
+    //query falls back to a search on the grid until it is updated
+    const auto use_abstraction = hierarchy.isUpToDate();
+
+    //the cells are 4-connected, whatever neigbours the graph uses
+    const ManhattanHeuristic manhattan;
+
+    distances_[graph.nodeToIndex(source)] = 0;
+    touched_.emplace_back(graph.nodeToIndex(source));
+    pq_.emplace(source, Distance{0}, manhattan.estimateDistance(source, target));
+
+    while(!pq_.empty()) {
+        const auto [current, current_dist, _] = pq_.top();
+        pq_.pop();
+
+        //skip outdated queue entries
+        if(current_dist > distances_[graph.nodeToIndex(current)]) {
+            continue;
+        }
+
+        expanded_nodes_++;
+
+        if(current == target) {
+            return current_dist;
+        }
+
+        const auto visit = [&](auto neig, auto new_dist) {
+            const auto neig_idx = graph.nodeToIndex(neig);
+
+            if(distances_[neig_idx] > new_dist) {
+                if(distances_[neig_idx] == UNREACHABLE) {
+                    touched_.emplace_back(neig_idx);
+                }
+                distances_[neig_idx] = new_dist;
+                before_[neig_idx] = current;
+                pq_.emplace(neig, new_dist, manhattan.estimateDistance(neig, target));
+            }
+        };
+
+        const auto level_opt = use_abstraction
+            ? findQueryLevel(current, source, target)
+            : std::nullopt;
+
+        //the leaf cells of source and target are searched on the grid
+        if(!level_opt) {
+            for(auto neig : graph.getManhattanNeigbours(current)) {
+                if(!graph.isBarrier(neig)) {
+                    visit(neig, current_dist + 1);
+                }
+            }
+            continue;
+        }
+
+        const auto level = level_opt.value();
+        const auto cell = hierarchy.getCellId(level, current);
+        const auto entrances = hierarchy.getEntrances(level, cell);
+        const auto from = hierarchy.getEntranceIndex(level, current);
+
+        //cross the cell
+        for(std::size_t to = 0; to < entrances.size(); to++) {
+            const auto cell_dist = hierarchy.getCellDistance(level, cell, from, to);
+            if(to != from and cell_dist != UNREACHABLE) {
+                visit(entrances[to], current_dist + cell_dist);
+            }
+        }
+
+        //leave the cell
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(!graph.isBarrier(neig) and hierarchy.getCellId(level, neig) != cell) {
+                visit(neig, current_dist + 1);
+            }
+        }
+    }
+
+    return UNREACHABLE;
+}
+
+auto HierarchicalAStar::findQueryLevel(graph::Node n,
+                                       graph::Node source,
+                                       graph::Node target) const noexcept
+    -> std::optional<std::size_t>
+{
+    const auto& hierarchy = hierarchy_.get();
+
+    for(std::size_t level = 0; level < hierarchy.getNumberOfLevels(); level++) {
+        const auto cell = hierarchy.getCellId(level, n);
+
+        if(cell != hierarchy.getCellId(level, source)
+           and cell != hierarchy.getCellId(level, target)) {
+            return level;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto HierarchicalAStar::refineSegment(std::vector<graph::Node>& nodes,
+                                      const graph::GridCell& cell,
+                                      graph::Node target) noexcept
+    -> void
+{
+    const auto& graph = hierarchy_.get().getGraph();
+
+    for(auto n : refine_queue_) {
+        refine_distances_[graph.nodeToIndex(n)] = UNREACHABLE;
+    }
+    refine_queue_.clear();
+
+    //breadth first search from the target until the start is reached
+    const auto start = nodes.back();
+    refine_distances_[graph.nodeToIndex(target)] = 0;
+    refine_queue_.emplace_back(target);
+
+    for(std::size_t head = 0; head < refine_queue_.size(); head++) {
+        const auto current = refine_queue_[head];
+        if(current == start) {
+            break;
+        }
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig) or !cell.isInCell(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(refine_distances_[neig_idx] == UNREACHABLE) {
+                refine_distances_[neig_idx] = refine_distances_[graph.nodeToIndex(current)] + 1;
+                refine_queue_.emplace_back(neig);
+            }
+        }
+    }
+
+    while(nodes.back() != target) {
+        const auto current = nodes.back();
+        const auto current_dist = refine_distances_[graph.nodeToIndex(current)];
+        const auto neigbours = graph.getManhattanNeigbours(current);
+
+        const auto next = std::find_if(std::begin(neigbours),
+                                       std::end(neigbours),
+                                       [&](auto neig) {
+                                           return !graph.isBarrier(neig)
+                                               and cell.isInCell(neig)
+                                               and refine_distances_[graph.nodeToIndex(neig)] + 1 == current_dist;
+                                       });
+        nodes.emplace_back(*next);
+    }
+}
+
+auto HierarchicalAStar::extractShortestPath(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    const auto& hierarchy = hierarchy_.get();
+    const auto& graph = hierarchy.getGraph();
+
+    //nodes of the abstract path from the target back to the source
+    std::vector<Node> abstract{target};
+    while(abstract.back() != source) {
+        abstract.emplace_back(before_[graph.nodeToIndex(abstract.back())]);
+    }
+
+    std::reverse(std::begin(abstract),
+                 std::end(abstract));
+
+    //consecutive nodes are either neigbours or entrances of the cell which
+    //was crossed
+    std::vector<Node> nodes{source};
+    for(std::size_t i = 1; i < abstract.size(); i++) {
+        const auto from = abstract[i - 1];
+        const auto to = abstract[i];
+
+        if(from.isManhattanNeigbourOf(to)) {
+            nodes.emplace_back(to);
+            continue;
+        }
+
+        const auto level = findQueryLevel(from, source, target).value();
+        const auto& cell = hierarchy.getCell(level, hierarchy.getCellId(level, from));
+        refineSegment(nodes, cell, to);
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto HierarchicalAStar::reset() noexcept
+    -> void
+{
+    for(auto idx : touched_) {
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+    }
+
+    touched_.clear();
+    pq_ = AStarQueue{AStarQueueComparer{}};
+}
@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <graph/GridCell.hpp>
+#include <graph/GridCorner.hpp>
+#include <graph/GridGraph.hpp>
+#include <nonstd/span.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/HierarchicalGraph.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridCell;
+using graph::GridCorner;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::HierarchicalGraph;
+
+
+HierarchicalGraph::HierarchicalGraph(const graph::GridGraph& graph,
+                                     std::size_t leaf_size,
+                                     std::size_t number_of_levels) noexcept
+    : graph_(graph),
+      last_graph_version_(graph.getVersion()),
+      abstracted_barriers_(graph.size(), false),
+      leaf_size_(2),
+      top_depth_(0),
+      leaf_depth_(0),
+      cell_distances_(graph.size(), UNREACHABLE)
+{
+    for(std::size_t idx = 0; idx < graph.size(); idx++) {
+        abstracted_barriers_[idx] = graph.isBarrier(graph.indexToNode(idx));
+    }
+
+    while(leaf_size_ < leaf_size) {
+        leaf_size_ *= 2;
+    }
+
+    root_side_ = leaf_size_;
+    while(root_side_ < std::max(graph.getHeight(), graph.getWidth())) {
+        root_side_ *= 2;
+        leaf_depth_++;
+    }
+
+    const auto kept_levels = std::max(number_of_levels, std::size_t{1});
+    if(leaf_depth_ + 1 > kept_levels) {
+        top_depth_ = leaf_depth_ + 1 - kept_levels;
+    }
+
+    const auto levels = leaf_depth_ - top_depth_ + 1;
+    levels_.resize(levels);
+    entrance_indices_.resize(levels, std::vector(graph.size(), NO_ENTRANCE));
+
+    for(std::size_t level = 0; level < levels; level++) {
+        const auto side = getCellSide(level);
+        cells_per_row_.emplace_back((graph.getWidth() + side - 1) / side);
+    }
+
+    const auto root_border = static_cast<std::int64_t>(root_side_ - 1);
+    buildCells(GridCell{GridCorner{0, 0},
+                        GridCorner{root_border, root_border}},
+               0);
+
+    //the quadtree is traversed in z-order, the cells are stored row by row
+    for(std::size_t level = 0; level < levels; level++) {
+        auto& cells = levels_[level];
+        std::sort(std::begin(cells),
+                  std::end(cells),
+                  [&](const auto& lhs, const auto& rhs) {
+                      return getCellId(level, lhs.cell[0]) < getCellId(level, rhs.cell[0]);
+                  });
+
+        for(std::size_t cell = 0; cell < cells.size(); cell++) {
+            abstractCell(level, cell);
+        }
+    }
+}
+
+auto HierarchicalGraph::getNumberOfLevels() const noexcept
+    -> std::size_t
+{
+    return levels_.size();
+}
+
+auto HierarchicalGraph::getNumberOfCells(std::size_t level) const noexcept
+    -> std::size_t
+{
+    return levels_[level].size();
+}
+
+auto HierarchicalGraph::getCellId(std::size_t level, graph::Node n) const noexcept
+    -> std::size_t
+{
+    const auto side = getCellSide(level);
+    return (n.row / side) * cells_per_row_[level] + n.column / side;
+}
+
+auto HierarchicalGraph::getCell(std::size_t level, std::size_t cell) const noexcept
+    -> const graph::GridCell&
+{
+    return levels_[level][cell].cell;
+}
+
+auto HierarchicalGraph::getEntrances(std::size_t level, std::size_t cell) const noexcept
+    -> nonstd::span<const graph::Node>
+{
+    return levels_[level][cell].entrances;
+}
+
+auto HierarchicalGraph::getEntranceIndex(std::size_t level, graph::Node n) const noexcept
+    -> std::uint32_t
+{
+    return entrance_indices_[level][graph_.get().nodeToIndex(n)];
+}
+
+auto HierarchicalGraph::getCellDistance(std::size_t level,
+                                        std::size_t cell,
+                                        std::size_t from_entrance,
+                                        std::size_t to_entrance) const noexcept
+    -> graph::Distance
+{
+    const auto& abstract = levels_[level][cell];
+    return abstract.distances[from_entrance * abstract.entrances.size() + to_entrance];
+}
+
+auto HierarchicalGraph::update(graph::Node changed) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    //the entrances of the neigbouring cells depend on the changed node too
+    std::vector<Node> nodes{changed};
+    for(auto neig : graph.getManhattanNeigbours(changed)) {
+        if(neig.row < graph.getHeight() and neig.column < graph.getWidth()) {
+            nodes.emplace_back(neig);
+        }
+    }
+
+    for(std::size_t level = 0; level < levels_.size(); level++) {
+        std::vector<std::size_t> cells;
+        for(auto n : nodes) {
+            cells.emplace_back(getCellId(level, n));
+        }
+
+        std::sort(std::begin(cells),
+                  std::end(cells));
+        cells.erase(std::unique(std::begin(cells),
+                                std::end(cells)),
+                    std::end(cells));
+
+        for(auto cell : cells) {
+            abstractCell(level, cell);
+        }
+    }
+
+    abstracted_barriers_[graph.nodeToIndex(changed)] = graph.isBarrier(changed);
+
+    //counting the reported nodes is not enough, a node which did not
+    //change does not change the version either
+    for(auto node : graph.getChangedNodesSince(last_graph_version_)) {
+        if(abstracted_barriers_[graph.nodeToIndex(node)] != graph.isBarrier(node)) {
+            return;
+        }
+    }
+
+    last_graph_version_ = graph.getVersion();
+}
+
+auto HierarchicalGraph::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == last_graph_version_;
+}
+
+auto HierarchicalGraph::getIndexSize() const noexcept
+    -> std::size_t
+{
+    std::size_t size = 0;
+    for(std::size_t level = 0; level < levels_.size(); level++) {
+        size += entrance_indices_[level].size() * sizeof(std::uint32_t);
+
+        for(const auto& abstract : levels_[level]) {
+            size += abstract.entrances.size() * sizeof(Node)
+                + abstract.distances.size() * sizeof(Distance);
+        }
+    }
+
+    return size;
+}
+
+auto HierarchicalGraph::getGraph() const noexcept
+    -> const graph::GridGraph&
+{
+    return graph_.get();
+}
+
+auto HierarchicalGraph::buildCells(const graph::GridCell& cell, std::size_t depth) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto top_left = cell[0];
+
+    //the root cell is padded to a power of two, cells outside of the grid
+    //are dropped
+    if(top_left.row >= graph.getHeight() or top_left.column >= graph.getWidth()) {
+        return;
+    }
+
+    if(depth >= top_depth_) {
+        levels_[depth - top_depth_].emplace_back(AbstractCell{cell, {}, {}});
+    }
+
+    if(depth < leaf_depth_) {
+        for(const auto& child : cell.split()) {
+            buildCells(child, depth + 1);
+        }
+    }
+}
+
+auto HierarchicalGraph::abstractCell(std::size_t level, std::size_t cell) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    auto& abstract = levels_[level][cell];
+
+    for(auto n : abstract.entrances) {
+        entrance_indices_[level][graph.nodeToIndex(n)] = NO_ENTRANCE;
+    }
+    abstract.entrances.clear();
+
+    const auto top_left = abstract.cell[0];
+    const auto side = getCellSide(level);
+    const auto bottom = std::min(top_left.row + side, graph.getHeight()) - 1;
+    const auto right = std::min(top_left.column + side, graph.getWidth()) - 1;
+
+    //only nodes on the border of the cell can have neigbours outside of it
+    for(auto row = top_left.row; row <= bottom; row++) {
+        for(auto column = top_left.column; column <= right; column++) {
+            const auto on_border = row == top_left.row or row == bottom
+                or column == top_left.column or column == right;
+            const Node node{row, column};
+
+            if(!on_border or graph.isBarrier(node)) {
+                continue;
+            }
+
+            const auto neigbours = graph.getManhattanNeigbours(node);
+            const auto is_entrance = std::any_of(std::begin(neigbours),
+                                                 std::end(neigbours),
+                                                 [&](auto neig) {
+                                                     return !graph.isBarrier(neig)
+                                                         and !abstract.cell.isInCell(neig);
+                                                 });
+
+            if(is_entrance) {
+                entrance_indices_[level][graph.nodeToIndex(node)] =
+                    static_cast<std::uint32_t>(abstract.entrances.size());
+                abstract.entrances.emplace_back(node);
+            }
+        }
+    }
+
+    const auto number_of_entrances = abstract.entrances.size();
+    abstract.distances.assign(number_of_entrances * number_of_entrances, UNREACHABLE);
+
+    for(std::size_t from = 0; from < number_of_entrances; from++) {
+        searchInCell(abstract.cell, abstract.entrances[from]);
+
+        for(std::size_t to = 0; to < number_of_entrances; to++) {
+            abstract.distances[from * number_of_entrances + to] =
+                cell_distances_[graph.nodeToIndex(abstract.entrances[to])];
+        }
+    }
+}
+
+auto HierarchicalGraph::searchInCell(const graph::GridCell& cell, graph::Node from) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    for(auto n : cell_queue_) {
+        cell_distances_[graph.nodeToIndex(n)] = UNREACHABLE;
+    }
+    cell_queue_.clear();
+
+    cell_distances_[graph.nodeToIndex(from)] = 0;
+    cell_queue_.emplace_back(from);
+
+    for(std::size_t head = 0; head < cell_queue_.size(); head++) {
+        const auto current = cell_queue_[head];
+        const auto current_dist = cell_distances_[graph.nodeToIndex(current)];
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig) or !cell.isInCell(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(cell_distances_[neig_idx] == UNREACHABLE) {
+                cell_distances_[neig_idx] = current_dist + 1;
+                cell_queue_.emplace_back(neig);
+            }
+        }
+    }
+}
+
+auto HierarchicalGraph::getCellSide(std::size_t level) const noexcept
+    -> std::size_t
+{
+    return root_side_ >> (top_depth_ + level);
+}
@@ -0,0 +1,407 @@
+#include <algorithm>
+#include <fmt/core.h>
+#include <graph/GridGraph.hpp>
+#include <numeric>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/HubLabelDistanceOracle.hpp>
+#include <progresscpp/ProgressBar.hpp>
+#include <random>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::DistanceAStar;
+using pathfinding::HubLabelDistanceOracle;
+
+namespace {
+
+using Hub = std::uint32_t;
+using Label = std::vector<std::pair<Hub, Distance>>;
+
+struct PrunedSearchWorkspace
+{
+    std::vector<Distance> root_label;
+    std::vector<Distance> distances;
+    std::vector<std::size_t> queue;
+};
+
+// number of random shortest path trees which are used to approximate
+// the betweenness of the nodes
+constexpr auto RANKING_SAMPLES = 16ul;
+
+// maximal number of roots which are processed in parallel
+constexpr auto MAX_BATCH_SIZE = 1024ul;
+
+// breadth first search from the given root, which does not expand nodes
+// whose distance to the root can already be answered by the committed labels
+auto prunedSearch(const GridGraph& graph,
+                  const std::vector<Label>& labels,
+                  Node root,
+                  PrunedSearchWorkspace& workspace) noexcept
+    -> std::vector<std::pair<std::size_t, Distance>>
+{
+    std::vector<std::pair<std::size_t, Distance>> found;
+
+    const auto root_idx = graph.nodeToIndex(root);
+    for(auto [hub, dist] : labels[root_idx]) {
+        workspace.root_label[hub] = dist;
+    }
+
+    workspace.queue.clear();
+    workspace.queue.emplace_back(root_idx);
+    workspace.distances[root_idx] = 0;
+
+    for(std::size_t head = 0; head < workspace.queue.size(); head++) {
+        const auto current_idx = workspace.queue[head];
+        const auto current_dist = workspace.distances[current_idx];
+
+        const auto is_covered =
+            std::any_of(std::cbegin(labels[current_idx]),
+                        std::cend(labels[current_idx]),
+                        [&](auto entry) {
+                            auto [hub, dist] = entry;
+                            auto root_dist = workspace.root_label[hub];
+                            return root_dist != UNREACHABLE
+                                and root_dist + dist <= current_dist;
+                        });
+
+        if(is_covered) {
+            continue;
+        }
+
+        found.emplace_back(current_idx, current_dist);
+
+        const auto current = graph.indexToNode(current_idx);
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(workspace.distances[neig_idx] == UNREACHABLE) {
+                workspace.distances[neig_idx] = current_dist + 1;
+                workspace.queue.emplace_back(neig_idx);
+            }
+        }
+    }
+
+    //reset the workspace
+    for(auto idx : workspace.queue) {
+        workspace.distances[idx] = UNREACHABLE;
+    }
+    for(auto [hub, _] : labels[root_idx]) {
+        workspace.root_label[hub] = UNREACHABLE;
+    }
+
+    return found;
+}
+
+} // namespace
+
+HubLabelDistanceOracle::HubLabelDistanceOracle(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion())
+{
+    const auto ranking = calculateRanking();
+    buildLabels(ranking);
+}
+
+auto HubLabelDistanceOracle::findDistance(graph::Node from, graph::Node to) const noexcept
+    -> graph::Distance
+{
+    if(graph_.get().isBarrier(from) or graph_.get().isBarrier(to)) {
+        return UNREACHABLE;
+    }
+
+    if(from == to) {
+        return 0;
+    }
+
+    //the labels of another barrier layout can be too short or too long
+    if(!isUpToDate()) {
+        return DistanceAStar{graph_.get()}.findDistance(from, to);
+    }
+
+    const auto from_idx = graph_.get().nodeToIndex(from);
+    const auto to_idx = graph_.get().nodeToIndex(to);
+
+    return intersectLabels(from_idx, to_idx);
+}
+
+auto HubLabelDistanceOracle::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto HubLabelDistanceOracle::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return label_offsets_.size() * sizeof(std::size_t)
+        + label_hubs_.size() * sizeof(Hub)
+        + label_distances_.size() * sizeof(Distance);
+}
+
+auto HubLabelDistanceOracle::getAverageLabelSize() const noexcept
+    -> double
+{
+    const auto walkable = graph_.get().countWalkableNodes();
+    if(walkable == 0) {
+        return 0.;
+    }
+
+    //every label of the flat array is terminated by a sentinel
+    const auto entries = label_hubs_.size() - (label_offsets_.size() - 1);
+    return static_cast<double>(entries) / static_cast<double>(walkable);
+}
+
+auto HubLabelDistanceOracle::calculateRanking() const noexcept
+    -> std::vector<graph::Node>
+{
+    const auto& graph = graph_.get();
+
+    std::vector<Node> nodes(std::begin(graph), std::end(graph));
+    if(nodes.empty()) {
+        return nodes;
+    }
+
+    // approximate the betweenness of every node by the sum of the subtree
+    // sizes in some shortest path trees with random roots
+    std::vector<std::size_t> scores(graph.size(), 0);
+    std::vector<std::size_t> subtree_sizes(graph.size(), 0);
+    std::vector<std::size_t> parents(graph.size(), graph.size());
+    std::vector<bool> visited(graph.size(), false);
+    std::vector<std::size_t> queue;
+    queue.reserve(nodes.size());
+
+    std::mt19937 gen(nodes.size());
+    std::uniform_int_distribution<std::size_t> root_dis(0, nodes.size() - 1);
+
+    for(std::size_t sample = 0; sample < RANKING_SAMPLES; sample++) {
+        const auto root_idx = graph.nodeToIndex(nodes[root_dis(gen)]);
+
+        queue.clear();
+        queue.emplace_back(root_idx);
+        visited[root_idx] = true;
+
+        for(std::size_t head = 0; head < queue.size(); head++) {
+            const auto current = graph.indexToNode(queue[head]);
+            for(auto neig : graph.getManhattanNeigbours(current)) {
+                if(graph.isBarrier(neig)) {
+                    continue;
+                }
+                const auto neig_idx = graph.nodeToIndex(neig);
+                if(!visited[neig_idx]) {
+                    visited[neig_idx] = true;
+                    parents[neig_idx] = queue[head];
+                    queue.emplace_back(neig_idx);
+                }
+            }
+        }
+
+        for(auto iter = std::rbegin(queue); iter != std::rend(queue); ++iter) {
+            const auto idx = *iter;
+            subtree_sizes[idx]++;
+            scores[idx] += subtree_sizes[idx];
+
+            if(parents[idx] != graph.size()) {
+                subtree_sizes[parents[idx]] += subtree_sizes[idx];
+            }
+        }
+
+        for(auto idx : queue) {
+            subtree_sizes[idx] = 0;
+            parents[idx] = graph.size();
+            visited[idx] = false;
+        }
+    }
+
+    std::stable_sort(std::begin(nodes),
+                     std::end(nodes),
+                     [&](auto lhs, auto rhs) {
+                         return scores[graph.nodeToIndex(lhs)]
+                             > scores[graph.nodeToIndex(rhs)];
+                     });
+
+    return nodes;
+}
+
+auto HubLabelDistanceOracle::buildLabels(const std::vector<graph::Node>& ranking) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    fmt::print("computing hub labels...\n");
+
+    std::vector<Label> labels(graph.size());
+
+    tbb::enumerable_thread_specific<PrunedSearchWorkspace> workspaces{
+        [&] {
+            return PrunedSearchWorkspace{std::vector(ranking.size(), UNREACHABLE),
+                                         std::vector(graph.size(), UNREACHABLE),
+                                         {}};
+        }};
+
+    progresscpp::ProgressBar bar{ranking.size(), 80ul};
+
+    // the most important roots are processed one by one, later roots are
+    // processed in growing parallel batches. Roots of the same batch do not
+    // prune each other, which only makes the labels larger but never wrong
+    std::size_t processed = 0;
+    while(processed < ranking.size()) {
+        const auto batch_size = std::min({std::max(processed / 8, 1ul),
+                                          MAX_BATCH_SIZE,
+                                          ranking.size() - processed});
+
+        std::vector<std::vector<std::pair<std::size_t, Distance>>> found(batch_size);
+
+        tbb::parallel_for(std::size_t{0},
+                          batch_size,
+                          [&](auto i) {
+                              const auto rank = processed + i;
+                              found[i] = prunedSearch(graph,
+                                                      labels,
+                                                      ranking[rank],
+                                                      workspaces.local());
+                          });
+
+        for(std::size_t i = 0; i < batch_size; i++) {
+            const auto rank = static_cast<Hub>(processed + i);
+            for(auto [idx, dist] : found[i]) {
+                labels[idx].emplace_back(rank, dist);
+            }
+        }
+
+        processed += batch_size;
+        bar += batch_size;
+        bar.displayIfChangedAtLeast(0.02);
+    }
+    bar.done();
+
+    //flatten the labels into one array
+    const auto total_entries =
+        std::accumulate(std::cbegin(labels),
+                        std::cend(labels),
+                        labels.size(),
+                        [](auto init, const auto& label) {
+                            return init + label.size();
+                        });
+
+    label_offsets_.reserve(labels.size() + 1);
+    label_hubs_.reserve(total_entries);
+    label_distances_.reserve(total_entries);
+
+    for(auto& label : labels) {
+        label_offsets_.emplace_back(label_hubs_.size());
+        for(auto [hub, dist] : label) {
+            label_hubs_.emplace_back(hub);
+            label_distances_.emplace_back(dist);
+        }
+        label_hubs_.emplace_back(LABEL_END);
+        label_distances_.emplace_back(UNREACHABLE);
+
+        label = Label{};
+    }
+    label_offsets_.emplace_back(label_hubs_.size());
+}
+
+auto HubLabelDistanceOracle::intersectLabels(std::size_t first_idx,
+                                             std::size_t second_idx) const noexcept
+    -> graph::Distance
+{
+    const auto* first_hubs = label_hubs_.data() + label_offsets_[first_idx];
+    const auto* second_hubs = label_hubs_.data() + label_offsets_[second_idx];
+    const auto* first_dists = label_distances_.data() + label_offsets_[first_idx];
+    const auto* second_dists = label_distances_.data() + label_offsets_[second_idx];
+
+    //-1 because of the sentinel at the end of every label
+    const auto first_size = label_offsets_[first_idx + 1] - label_offsets_[first_idx] - 1;
+    const auto second_size = label_offsets_[second_idx + 1] - label_offsets_[second_idx] - 1;
+
+    auto best = UNREACHABLE;
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    const auto update_best = [&](std::size_t first_pos, std::size_t block_begin, std::size_t block_size) {
+        const auto hub = first_hubs[first_pos];
+        for(auto k = block_begin; k < block_begin + block_size; k++) {
+            if(second_hubs[k] == hub) {
+                best = std::min<Distance>(best, first_dists[first_pos] + second_dists[k]);
+                return;
+            }
+        }
+    };
+
+#if defined(__AVX2__)
+    // compare blocks of 8 hubs against all rotations of the other block
+    const auto rotation = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+    while(i + 8 <= first_size and j + 8 <= second_size) {
+        const auto first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first_hubs + i));
+        auto second_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second_hubs + j));
+
+        auto equal = _mm256_cmpeq_epi32(first_block, second_block);
+        for(int r = 1; r < 8; r++) {
+            second_block = _mm256_permutevar8x32_epi32(second_block, rotation);
+            equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(first_block, second_block));
+        }
+
+        auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+        while(mask != 0) {
+            update_best(i + __builtin_ctz(mask), j, 8);
+            mask &= mask - 1;
+        }
+
+        const auto first_max = first_hubs[i + 7];
+        const auto second_max = second_hubs[j + 7];
+        i += first_max <= second_max ? 8 : 0;
+        j += second_max <= first_max ? 8 : 0;
+    }
+#elif defined(__SSE2__)
+    // compare blocks of 4 hubs against all rotations of the other block
+    while(i + 4 <= first_size and j + 4 <= second_size) {
+        const auto first_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first_hubs + i));
+        auto second_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second_hubs + j));
+
+        auto equal = _mm_cmpeq_epi32(first_block, second_block);
+        for(int r = 1; r < 4; r++) {
+            second_block = _mm_shuffle_epi32(second_block, _MM_SHUFFLE(0, 3, 2, 1));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi32(first_block, second_block));
+        }
+
+        auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+        while(mask != 0) {
+            update_best(i + __builtin_ctz(mask), j, 4);
+            mask &= mask - 1;
+        }
+
+        const auto first_max = first_hubs[i + 3];
+        const auto second_max = second_hubs[j + 3];
+        i += first_max <= second_max ? 4 : 0;
+        j += second_max <= first_max ? 4 : 0;
+    }
+#endif
+
+    //scalar merge of the remaining hubs
+    while(i < first_size and j < second_size) {
+        if(first_hubs[i] < second_hubs[j]) {
+            i++;
+        } else if(first_hubs[i] > second_hubs[j]) {
+            j++;
+        } else {
+            best = std::min<Distance>(best, first_dists[i] + second_dists[j]);
+            i++;
+            j++;
+        }
+    }
+
+    return best;
+}
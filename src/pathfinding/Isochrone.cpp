@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Isochrone.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::Isochrone;
+
+
+Isochrone::Isochrone(graph::Node top_left,
+                     std::size_t height,
+                     std::size_t width,
+                     std::vector<bool> bitmap,
+                     std::size_t number_of_nodes) noexcept
+    : top_left_(top_left),
+      height_(height),
+      width_(width),
+      bitmap_(std::move(bitmap)),
+      number_of_nodes_(number_of_nodes) {}
+
+auto Isochrone::contains(graph::Node n) const noexcept
+    -> bool
+{
+    if(!isInBoundingBox(n)) {
+        return false;
+    }
+
+    return bitmap_[(n.row - top_left_.row) * width_ + (n.column - top_left_.column)];
+}
+
+auto Isochrone::size() const noexcept
+    -> std::size_t
+{
+    return number_of_nodes_;
+}
+
+auto Isochrone::empty() const noexcept
+    -> bool
+{
+    return number_of_nodes_ == 0;
+}
+
+auto Isochrone::getTopLeft() const noexcept
+    -> graph::Node
+{
+    return top_left_;
+}
+
+auto Isochrone::getHeight() const noexcept
+    -> std::size_t
+{
+    return height_;
+}
+
+auto Isochrone::getWidth() const noexcept
+    -> std::size_t
+{
+    return width_;
+}
+
+auto Isochrone::toIndices(const graph::GridGraph& graph) const noexcept
+    -> std::vector<std::size_t>
+{
+    //the bitmap is stored row by row like the grid, so the ids are sorted
+    std::vector<std::size_t> indices;
+    indices.reserve(number_of_nodes_);
+
+    for(auto n : toNodes()) {
+        indices.emplace_back(graph.nodeToIndex(n));
+    }
+
+    return indices;
+}
+
+auto Isochrone::toNodes() const noexcept
+    -> std::vector<graph::Node>
+{
+    std::vector<Node> nodes;
+    nodes.reserve(number_of_nodes_);
+
+    for(std::size_t i = 0; i < bitmap_.size(); i++) {
+        if(bitmap_[i]) {
+            nodes.emplace_back(Node{top_left_.row + i / width_,
+                                    top_left_.column + i % width_});
+        }
+    }
+
+    return nodes;
+}
+
+auto Isochrone::isInBoundingBox(graph::Node n) const noexcept
+    -> bool
+{
+    return n.row >= top_left_.row
+        and n.column >= top_left_.column
+        and n.row - top_left_.row < height_
+        and n.column - top_left_.column < width_;
+}
+
+auto pathfinding::findIsochrone(const graph::GridGraph& graph,
+                                graph::Node center,
+                                graph::Distance radius) noexcept
+    -> Isochrone
+{
+    if(graph.isBarrier(center) or radius < 0) {
+        return Isochrone{center, 0, 0, {}, 0};
+    }
+
+    //no distance exceeds the number of nodes, this also keeps the bounding
+    //box from overflowing for UNREACHABLE as radius
+    const auto r = std::min(static_cast<std::size_t>(radius), graph.size());
+
+    const Node top_left{center.row - std::min(r, center.row),
+                        center.column - std::min(r, center.column)};
+    const auto height = std::min(center.row + r, graph.getHeight() - 1) - top_left.row + 1;
+    const auto width = std::min(center.column + r, graph.getWidth() - 1) - top_left.column + 1;
+
+    std::vector<bool> bitmap(height * width, false);
+    const auto to_bit = [&](auto n) {
+        return (n.row - top_left.row) * width + (n.column - top_left.column);
+    };
+
+    bitmap[to_bit(center)] = true;
+    std::size_t number_of_nodes = 1;
+
+    std::vector<Node> layer{center};
+    std::vector<Node> next_layer;
+    for(std::size_t distance = 0; distance < r and !layer.empty(); distance++) {
+        for(auto current : layer) {
+            for(auto neig : graph.getManhattanNeigbours(current)) {
+                //nodes in the next layer are always inside the bounding box
+                if(graph.isBarrier(neig) or bitmap[to_bit(neig)]) {
+                    continue;
+                }
+
+                bitmap[to_bit(neig)] = true;
+                next_layer.emplace_back(neig);
+            }
+        }
+
+        number_of_nodes += next_layer.size();
+        std::swap(layer, next_layer);
+        next_layer.clear();
+    }
+
+    return Isochrone{top_left,
+                     height,
+                     width,
+                     std::move(bitmap),
+                     number_of_nodes};
+}
@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/LPAStar.hpp>
+#include <queue>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::LPAStar;
+using pathfinding::Path;
+
+LPAStar::LPAStar(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      g_(graph.size(), UNREACHABLE),
+      rhs_(graph.size(), UNREACHABLE),
+      touched_flags_(graph.size(), false),
+      last_graph_version_(graph.getVersion()),
+      repaired_barriers_(graph.size(), false)
+{
+    for(std::size_t idx = 0; idx < graph.size(); idx++) {
+        repaired_barriers_[idx] = graph.isBarrier(graph.indexToNode(idx));
+    }
+}
+
+auto LPAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath();
+}
+
+auto LPAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    return computeDistance(source, target);
+}
+
+auto LPAStar::updateNodes(const std::vector<graph::Node>& changed_nodes) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    for(auto node : changed_nodes) {
+        repaired_barriers_[graph.nodeToIndex(node)] = graph.isBarrier(node);
+
+        if(!last_source_) {
+            continue;
+        }
+
+        //a changed node changes its own lookahead and the one of all its neigbours
+        updateNode(node);
+
+        for(auto neig : graph.getManhattanNeigbours(node)) {
+            if(graph.isWalkableNode(neig)) {
+                updateNode(neig);
+            }
+        }
+    }
+
+    syncGraphVersion();
+}
+
+auto LPAStar::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto LPAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    expanded_nodes_ = 0;
+
+    if(graph_.get().isBarrier(source)
+       or graph_.get().isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    //the keys depend on the target, so a new pair starts a new search
+    //the search can not be repaired if barriers changed unnoticed
+    if(source != last_source_
+       or target != last_target_
+       or graph_.get().getVersion() != last_graph_version_) {
+        initialize(source, target);
+    }
+
+    computeShortestPath();
+
+    return g_[graph_.get().nodeToIndex(target)];
+}
+
+auto LPAStar::calculateKey(graph::Node n) const noexcept
+    -> Key
+{
+    const auto idx = graph_.get().nodeToIndex(n);
+    const auto min_dist = std::min(g_[idx], rhs_[idx]);
+
+    if(min_dist == UNREACHABLE) {
+        return Key{UNREACHABLE, UNREACHABLE};
+    }
+
+    return Key{min_dist + estimateDistance(n), min_dist};
+}
+
+auto LPAStar::estimateDistance(graph::Node n) const noexcept
+    -> graph::Distance
+{
+    const auto target = last_target_.value();
+
+    return (std::max(n.row, target.row)
+            - std::min(n.row, target.row))
+        + (std::max(n.column, target.column)
+           - std::min(n.column, target.column));
+}
+
+auto LPAStar::updateNode(graph::Node n) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto idx = graph.nodeToIndex(n);
+
+    touch(idx);
+
+    if(n != last_source_) {
+        rhs_[idx] = UNREACHABLE;
+
+        if(graph.isWalkableNode(n)) {
+            for(auto neig : graph.getManhattanNeigbours(n)) {
+                if(graph.isBarrier(neig)) {
+                    continue;
+                }
+
+                const auto neig_dist = g_[graph.nodeToIndex(neig)];
+                if(neig_dist != UNREACHABLE) {
+                    rhs_[idx] = std::min<Distance>(rhs_[idx], neig_dist + 1);
+                }
+            }
+        }
+    }
+
+    //outdated entries of the node stay in the queue and are skipped later
+    if(g_[idx] != rhs_[idx]) {
+        const auto [first_key, second_key] = calculateKey(n);
+        pq_.emplace(first_key, second_key, n);
+    }
+}
+
+auto LPAStar::computeShortestPath() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto target = last_target_.value();
+    const auto target_idx = graph.nodeToIndex(target);
+
+    while(!pq_.empty()) {
+        const auto [first_key, second_key, current] = pq_.top();
+        const auto current_key = Key{first_key, second_key};
+
+        if(current_key >= calculateKey(target)
+           and g_[target_idx] == rhs_[target_idx]) {
+            return;
+        }
+
+        pq_.pop();
+
+        const auto current_idx = graph.nodeToIndex(current);
+
+        //skip entries which were replaced by a newer one
+        if(g_[current_idx] == rhs_[current_idx]
+           or current_key != calculateKey(current)) {
+            continue;
+        }
+
+        expanded_nodes_++;
+
+        if(g_[current_idx] > rhs_[current_idx]) {
+            g_[current_idx] = rhs_[current_idx];
+        } else {
+            g_[current_idx] = UNREACHABLE;
+            updateNode(current);
+        }
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isWalkableNode(neig)) {
+                updateNode(neig);
+            }
+        }
+    }
+}
+
+auto LPAStar::extractShortestPath() const noexcept
+    -> std::optional<Path>
+{
+    const auto& graph = graph_.get();
+    const auto source = last_source_.value();
+    const auto target = last_target_.value();
+
+    //walk back from the target, always to a neigbour which is one step closer
+    std::vector<Node> nodes{target};
+    while(nodes.back() != source) {
+        const auto current = nodes.back();
+        const auto current_dist = g_[graph.nodeToIndex(current)];
+
+        const auto neigbours = graph.getManhattanNeigbours(current);
+        const auto before = std::find_if(std::cbegin(neigbours),
+                                         std::cend(neigbours),
+                                         [&](auto neig) {
+                                             return graph.isWalkableNode(neig)
+                                                 and g_[graph.nodeToIndex(neig)] == current_dist - 1;
+                                         });
+
+        if(before == std::cend(neigbours)) {
+            return std::nullopt;
+        }
+
+        nodes.emplace_back(*before);
+    }
+
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
+}
+
+auto LPAStar::initialize(graph::Node source, graph::Node target) noexcept
+    -> void
+{
+    for(auto idx : touched_) {
+        g_[idx] = UNREACHABLE;
+        rhs_[idx] = UNREACHABLE;
+        touched_flags_[idx] = false;
+    }
+
+    touched_.clear();
+    pq_ = Queue{};
+
+    last_source_ = source;
+    last_target_ = target;
+
+    //the new search sees the current barriers of all nodes
+    for(auto node : graph_.get().getChangedNodesSince(last_graph_version_)) {
+        repaired_barriers_[graph_.get().nodeToIndex(node)] = graph_.get().isBarrier(node);
+    }
+    last_graph_version_ = graph_.get().getVersion();
+
+    const auto source_idx = graph_.get().nodeToIndex(source);
+    touch(source_idx);
+    rhs_[source_idx] = 0;
+
+    const auto [first_key, second_key] = calculateKey(source);
+    pq_.emplace(first_key, second_key, source);
+}
+
+auto LPAStar::touch(std::size_t idx) noexcept
+    -> void
+{
+    if(!touched_flags_[idx]) {
+        touched_flags_[idx] = true;
+        touched_.emplace_back(idx);
+    }
+}
+
+auto LPAStar::syncGraphVersion() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    //counting the reported nodes is not enough, a node which did not
+    //change does not change the version either
+    for(auto node : graph.getChangedNodesSince(last_graph_version_)) {
+        if(repaired_barriers_[graph.nodeToIndex(node)] != graph.isBarrier(node)) {
+            return;
+        }
+    }
+
+    last_graph_version_ = graph.getVersion();
+}
@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <fmt/core.h>
+#include <graph/GridGraph.hpp>
+#include <numeric>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Landmarks.hpp>
+#include <random>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::Landmarks;
+using pathfinding::LandmarkStrategy;
+
+Landmarks::Landmarks(const graph::GridGraph& graph,
+                     std::size_t count,
+                     LandmarkStrategy strategy) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion())
+{
+    const std::vector<Node> nodes(std::begin(graph), std::end(graph));
+    count = std::min(count, nodes.size());
+
+    fmt::print("selecting {} landmarks...\n", count);
+
+    std::mt19937 gen(nodes.size());
+    std::uniform_int_distribution<std::size_t> node_dis(0, std::max(nodes.size(), 1ul) - 1);
+
+    std::vector<std::vector<Distance>> landmark_distances;
+    while(landmarks_.size() < count) {
+        const auto start = nodes[node_dis(gen)];
+
+        const auto landmark = [&] {
+            if(strategy == LandmarkStrategy::AVOID and !landmarks_.empty()) {
+                if(auto avoid_opt = findAvoidLandmark(landmark_distances, start)) {
+                    return avoid_opt.value();
+                }
+            }
+            return findFarthestLandmark(landmark_distances, start);
+        }();
+
+        landmarks_.emplace_back(landmark);
+        landmark_distances.emplace_back(calculateDistancesFrom(landmark));
+    }
+
+    const auto landmark_count = landmarks_.size();
+    distances_.resize(graph.size() * landmark_count, UNREACHABLE);
+    for(std::size_t l = 0; l < landmark_count; l++) {
+        for(std::size_t idx = 0; idx < graph.size(); idx++) {
+            distances_[idx * landmark_count + l] = landmark_distances[l][idx];
+        }
+    }
+}
+
+auto Landmarks::getLowerBound(graph::Node from, graph::Node to) const noexcept
+    -> graph::Distance
+{
+    //an opened barrier can make the old bounds larger than the distance,
+    //so A* with an outdated bound would not be admissible anymore
+    if(!isUpToDate()) {
+        return 0;
+    }
+
+    const auto landmark_count = landmarks_.size();
+    const auto* from_distances = distances_.data() + graph_.get().nodeToIndex(from) * landmark_count;
+    const auto* to_distances = distances_.data() + graph_.get().nodeToIndex(to) * landmark_count;
+
+    Distance bound = 0;
+    for(std::size_t l = 0; l < landmark_count; l++) {
+        const auto from_dist = from_distances[l];
+        const auto to_dist = to_distances[l];
+
+        if(from_dist == UNREACHABLE or to_dist == UNREACHABLE) {
+            continue;
+        }
+
+        const auto diff = from_dist > to_dist
+            ? from_dist - to_dist
+            : to_dist - from_dist;
+
+        bound = std::max<Distance>(bound, diff);
+    }
+
+    return bound;
+}
+
+auto Landmarks::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto Landmarks::getLandmarks() const noexcept
+    -> const std::vector<graph::Node>&
+{
+    return landmarks_;
+}
+
+auto Landmarks::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return distances_.size() * sizeof(Distance);
+}
+
+auto Landmarks::calculateDistancesFrom(graph::Node source) const noexcept
+    -> std::vector<graph::Distance>
+{
+    const auto& graph = graph_.get();
+
+    std::vector<Distance> distances(graph.size(), UNREACHABLE);
+    std::vector<Node> queue{source};
+    distances[graph.nodeToIndex(source)] = 0;
+
+    for(std::size_t head = 0; head < queue.size(); head++) {
+        const auto current = queue[head];
+        const auto current_dist = distances[graph.nodeToIndex(current)];
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(distances[neig_idx] == UNREACHABLE) {
+                distances[neig_idx] = current_dist + 1;
+                queue.emplace_back(neig);
+            }
+        }
+    }
+
+    return distances;
+}
+
+auto Landmarks::findFarthestLandmark(const std::vector<std::vector<Distance>>& landmark_distances,
+                                     graph::Node start) const noexcept
+    -> graph::Node
+{
+    const auto& graph = graph_.get();
+
+    //the first landmark is the node which is farthest away from a random start
+    if(landmark_distances.empty()) {
+        const auto distances = calculateDistancesFrom(start);
+
+        auto farthest = start;
+        Distance farthest_dist = 0;
+        for(auto node : graph) {
+            //ignore nodes in other components
+            const auto dist = distances[graph.nodeToIndex(node)];
+            if(dist != UNREACHABLE and dist > farthest_dist) {
+                farthest = node;
+                farthest_dist = dist;
+            }
+        }
+
+        return farthest;
+    }
+
+    //every further landmark maximizes the distance to its closest landmark.
+    //nodes which cannot be reached by any landmark are preferred, which
+    //places landmarks in every component of the graph
+    const auto min_landmark_distance = [&](auto node) {
+        const auto idx = graph.nodeToIndex(node);
+        return std::accumulate(std::cbegin(landmark_distances),
+                               std::cend(landmark_distances),
+                               UNREACHABLE,
+                               [&](auto init, const auto& distances) {
+                                   return std::min(init, distances[idx]);
+                               });
+    };
+
+    auto farthest = start;
+    Distance farthest_dist = -1;
+    for(auto node : graph) {
+        const auto dist = min_landmark_distance(node);
+        if(dist > farthest_dist) {
+            farthest = node;
+            farthest_dist = dist;
+        }
+    }
+
+    return farthest;
+}
+
+auto Landmarks::findAvoidLandmark(const std::vector<std::vector<Distance>>& landmark_distances,
+                                  graph::Node root) const noexcept
+    -> std::optional<graph::Node>
+{
+    const auto& graph = graph_.get();
+    const auto root_idx = graph.nodeToIndex(root);
+    const auto no_parent = graph.size();
+
+    //shortest path tree from the root
+    std::vector<std::size_t> queue{root_idx};
+    std::vector<std::size_t> parents(graph.size(), no_parent);
+    std::vector<Distance> distances(graph.size(), UNREACHABLE);
+    distances[root_idx] = 0;
+
+    for(std::size_t head = 0; head < queue.size(); head++) {
+        const auto current = graph.indexToNode(queue[head]);
+        const auto current_dist = distances[queue[head]];
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(distances[neig_idx] == UNREACHABLE) {
+                distances[neig_idx] = current_dist + 1;
+                parents[neig_idx] = queue[head];
+                queue.emplace_back(neig_idx);
+            }
+        }
+    }
+
+    //the weight of a node is the gap between its real distance to the root
+    //and the lower bound of the current landmarks. The size of a subtree is
+    //the sum of its weights, or zero if the subtree already holds a landmark
+    std::vector<Distance> sizes(graph.size(), 0);
+    std::vector<bool> has_landmark(graph.size(), false);
+    std::vector<std::size_t> best_child(graph.size(), no_parent);
+
+    for(auto landmark : landmarks_) {
+        has_landmark[graph.nodeToIndex(landmark)] = true;
+    }
+
+    for(auto iter = std::rbegin(queue); iter != std::rend(queue); ++iter) {
+        const auto idx = *iter;
+
+        Distance lower_bound = 0;
+        for(const auto& landmark_dists : landmark_distances) {
+            const auto root_dist = landmark_dists[root_idx];
+            const auto node_dist = landmark_dists[idx];
+            if(root_dist == UNREACHABLE or node_dist == UNREACHABLE) {
+                continue;
+            }
+            lower_bound = std::max<Distance>(lower_bound,
+                                             root_dist > node_dist
+                                                 ? root_dist - node_dist
+                                                 : node_dist - root_dist);
+        }
+
+        sizes[idx] += distances[idx] - lower_bound;
+
+        if(has_landmark[idx]) {
+            sizes[idx] = 0;
+        }
+
+        const auto parent = parents[idx];
+        if(parent == no_parent) {
+            continue;
+        }
+
+        has_landmark[parent] = has_landmark[parent] or has_landmark[idx];
+        sizes[parent] += sizes[idx];
+
+        if(best_child[parent] == no_parent
+           or sizes[best_child[parent]] < sizes[idx]) {
+            best_child[parent] = idx;
+        }
+    }
+
+    auto current = *std::max_element(std::begin(queue),
+                                     std::end(queue),
+                                     [&](auto lhs, auto rhs) {
+                                         return sizes[lhs] < sizes[rhs];
+                                     });
+
+    if(sizes[current] <= 0) {
+        return std::nullopt;
+    }
+
+    //walk down to a leaf, always following the largest subtree
+    while(best_child[current] != no_parent and sizes[best_child[current]] > 0) {
+        current = best_child[current];
+    }
+
+    return graph.indexToNode(current);
+}
@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <graph/GridCell.hpp>
+#include <graph/GridCorner.hpp>
+#include <graph/GridGraph.hpp>
+#include <nonstd/span.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/LocalDistanceDatabase.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridCell;
+using graph::GridCorner;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::LocalDistanceDatabase;
+
+
+LocalDistanceDatabase::LocalDistanceDatabase(const graph::GridGraph& graph,
+                                             std::size_t block_size) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      block_size_(std::clamp(block_size, std::size_t{2}, MAX_BLOCK_SIZE)),
+      blocks_per_row_((graph.getWidth() + block_size_ - 1) / block_size_),
+      blocks_per_column_((graph.getHeight() + block_size_ - 1) / block_size_),
+      perimeter_indices_(block_size_ * block_size_)
+{
+    for(std::size_t row = 0; row < block_size_; row++) {
+        for(std::size_t column = 0; column < block_size_; column++) {
+            if(row == 0 or column == 0
+               or row == block_size_ - 1
+               or column == block_size_ - 1) {
+                perimeter_indices_[row * block_size_ + column] = perimeter_.size();
+                perimeter_.emplace_back(Node{row, column});
+            }
+        }
+    }
+
+    const auto number_of_blocks = blocks_per_row_ * blocks_per_column_;
+    block_patterns_.reserve(number_of_blocks);
+
+    for(std::size_t block = 0; block < number_of_blocks; block++) {
+        block_patterns_.emplace_back(addPattern(calculatePattern(block)));
+    }
+}
+
+auto LocalDistanceDatabase::getBlockSize() const noexcept
+    -> std::size_t
+{
+    return block_size_;
+}
+
+auto LocalDistanceDatabase::getNumberOfBlocks() const noexcept
+    -> std::size_t
+{
+    return block_patterns_.size();
+}
+
+auto LocalDistanceDatabase::getNumberOfPatterns() const noexcept
+    -> std::size_t
+{
+    return patterns_.size();
+}
+
+auto LocalDistanceDatabase::getBlockOf(graph::Node n) const noexcept
+    -> std::size_t
+{
+    return (n.row / block_size_) * blocks_per_row_ + n.column / block_size_;
+}
+
+auto LocalDistanceDatabase::getBlockCell(std::size_t block) const noexcept
+    -> graph::GridCell
+{
+    const auto& graph = graph_.get();
+    const auto top_left = getBlockTopLeft(block);
+    const auto bottom = std::min(top_left.row + block_size_, graph.getHeight()) - 1;
+    const auto right = std::min(top_left.column + block_size_, graph.getWidth()) - 1;
+
+    return GridCell{GridCorner{static_cast<std::int64_t>(top_left.row),
+                               static_cast<std::int64_t>(top_left.column)},
+                    GridCorner{static_cast<std::int64_t>(bottom),
+                               static_cast<std::int64_t>(right)}};
+}
+
+auto LocalDistanceDatabase::getPerimeter() const noexcept
+    -> nonstd::span<const graph::Node>
+{
+    return perimeter_;
+}
+
+auto LocalDistanceDatabase::getPerimeterNode(std::size_t block,
+                                             std::size_t perimeter_idx) const noexcept
+    -> graph::Node
+{
+    const auto top_left = getBlockTopLeft(block);
+    const auto offset = perimeter_[perimeter_idx];
+
+    return Node{top_left.row + offset.row,
+                top_left.column + offset.column};
+}
+
+auto LocalDistanceDatabase::getPerimeterIndex(graph::Node n) const noexcept
+    -> std::optional<std::size_t>
+{
+    return perimeter_indices_[toLocalIndex(n)];
+}
+
+auto LocalDistanceDatabase::getLocalDistance(std::size_t block,
+                                             std::size_t from_perimeter_idx,
+                                             std::size_t to_perimeter_idx) const noexcept
+    -> graph::Distance
+{
+    const auto perimeter_size = perimeter_.size();
+    const auto offset = block_patterns_[block] * perimeter_size * perimeter_size;
+    const auto distance = distances_[offset
+                                     + from_perimeter_idx * perimeter_size
+                                     + to_perimeter_idx];
+
+    if(distance == LOCAL_UNREACHABLE) {
+        return UNREACHABLE;
+    }
+
+    return distance;
+}
+
+auto LocalDistanceDatabase::findLocalDistances(graph::Node from) const noexcept
+    -> LocalDistances
+{
+    const auto pattern = patterns_[block_patterns_[getBlockOf(from)]];
+    return bfs(pattern, toLocalIndex(from));
+}
+
+auto LocalDistanceDatabase::toLocalIndex(graph::Node n) const noexcept
+    -> std::size_t
+{
+    return (n.row % block_size_) * block_size_ + n.column % block_size_;
+}
+
+auto LocalDistanceDatabase::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return block_patterns_.size() * sizeof(std::uint32_t)
+        + patterns_.size() * sizeof(Pattern)
+        + pattern_ids_.size() * (sizeof(Pattern) + sizeof(std::uint32_t))
+        + distances_.size() * sizeof(LocalDistance);
+}
+
+auto LocalDistanceDatabase::getGraph() const noexcept
+    -> const graph::GridGraph&
+{
+    return graph_.get();
+}
+
+auto LocalDistanceDatabase::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto LocalDistanceDatabase::getBlockTopLeft(std::size_t block) const noexcept
+    -> graph::Node
+{
+    return Node{(block / blocks_per_row_) * block_size_,
+                (block % blocks_per_row_) * block_size_};
+}
+
+auto LocalDistanceDatabase::calculatePattern(std::size_t block) const noexcept
+    -> Pattern
+{
+    const auto& graph = graph_.get();
+    const auto top_left = getBlockTopLeft(block);
+
+    //nodes outside of the grid are barriers
+    Pattern pattern = 0;
+    for(std::size_t row = 0; row < block_size_; row++) {
+        for(std::size_t column = 0; column < block_size_; column++) {
+            const Node node{top_left.row + row,
+                            top_left.column + column};
+
+            if(graph.isWalkableNode(node)) {
+                pattern |= Pattern{1} << (row * block_size_ + column);
+            }
+        }
+    }
+
+    return pattern;
+}
+
+auto LocalDistanceDatabase::bfs(Pattern pattern, std::size_t from_local_idx) const noexcept
+    -> LocalDistances
+{
+    LocalDistances distances;
+    distances.fill(LOCAL_UNREACHABLE);
+
+    const auto is_walkable = [&](auto local_idx) {
+        return (pattern >> local_idx) & 1;
+    };
+
+    if(!is_walkable(from_local_idx)) {
+        return distances;
+    }
+
+    std::array<std::size_t, 64> queue;
+    std::size_t queue_end = 0;
+
+    distances[from_local_idx] = 0;
+    queue[queue_end++] = from_local_idx;
+
+    for(std::size_t head = 0; head < queue_end; head++) {
+        const auto current = queue[head];
+        const auto row = current / block_size_;
+        const auto column = current % block_size_;
+
+        const auto visit = [&](auto neig) {
+            if(is_walkable(neig) and distances[neig] == LOCAL_UNREACHABLE) {
+                distances[neig] = distances[current] + 1;
+                queue[queue_end++] = neig;
+            }
+        };
+
+        if(column + 1 < block_size_) {
+            visit(current + 1);
+        }
+        if(column > 0) {
+            visit(current - 1);
+        }
+        if(row > 0) {
+            visit(current - block_size_);
+        }
+        if(row + 1 < block_size_) {
+            visit(current + block_size_);
+        }
+    }
+
+    return distances;
+}
+
+auto LocalDistanceDatabase::addPattern(Pattern pattern) noexcept
+    -> std::uint32_t
+{
+    if(const auto iter = pattern_ids_.find(pattern);
+       iter != std::end(pattern_ids_)) {
+        return iter->second;
+    }
+
+    const auto id = static_cast<std::uint32_t>(patterns_.size());
+    pattern_ids_.emplace(pattern, id);
+    patterns_.emplace_back(pattern);
+
+    for(auto from : perimeter_) {
+        const auto distances = bfs(pattern, from.row * block_size_ + from.column);
+
+        for(auto to : perimeter_) {
+            distances_.emplace_back(distances[to.row * block_size_ + to.column]);
+        }
+    }
+
+    return id;
+}
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/MovingRootTree.hpp>
+#include <pathfinding/Path.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::MovingRootTree;
+using pathfinding::Path;
+
+
+MovingRootTree::MovingRootTree(const graph::GridGraph& graph, std::size_t max_drift) noexcept
+    : graph_(graph),
+      max_drift_(max_drift),
+      anchor_distances_(graph.size(), UNREACHABLE),
+      last_graph_version_(graph.getVersion()),
+      distances_(graph.size(), UNREACHABLE),
+      before_(graph.size(), graph::NOT_REACHABLE) {}
+
+auto MovingRootTree::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    if(graph_.get().isBarrier(source) or graph_.get().isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    moveAnchor(source);
+
+    //the source lies in the component of the anchor
+    if(anchor_ == source or getAnchorDistanceTo(target) == UNREACHABLE) {
+        expanded_nodes_ = 0;
+        return getAnchorDistanceTo(target);
+    }
+
+    return search(source, target);
+}
+
+auto MovingRootTree::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == findDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    const auto& graph = graph_.get();
+    std::vector<Node> nodes{target};
+
+    if(anchor_ == source) {
+        //every node except the anchor has a neigbour one step closer to it
+        nodes.reserve(getAnchorDistanceTo(target) + 1);
+
+        while(nodes.back() != source) {
+            const auto current = nodes.back();
+            const auto neigbours = graph.getManhattanNeigbours(current);
+            const auto next = std::find_if(std::begin(neigbours),
+                                           std::end(neigbours),
+                                           [&](auto neig) {
+                                               return !graph.isBarrier(neig)
+                                                   and getAnchorDistanceTo(neig) + 1 == getAnchorDistanceTo(current);
+                                           });
+            nodes.emplace_back(*next);
+        }
+    } else {
+        nodes.reserve(getDistanceTo(target) + 1);
+
+        while(nodes.back() != source) {
+            nodes.emplace_back(before_[graph.nodeToIndex(nodes.back())]);
+        }
+    }
+
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
+}
+
+auto MovingRootTree::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto MovingRootTree::getNumberOfRebuilds() const noexcept
+    -> std::size_t
+{
+    return rebuilds_;
+}
+
+auto MovingRootTree::moveAnchor(graph::Node source) noexcept
+    -> void
+{
+    //the tree is outdated if barriers changed since it was computed
+    if(graph_.get().getVersion() != last_graph_version_) {
+        last_graph_version_ = graph_.get().getVersion();
+        anchor_ = std::nullopt;
+    }
+
+    //the bound gets weaker the farther the source drifts from the anchor
+    if(!anchor_
+       or getAnchorDistanceTo(source) == UNREACHABLE
+       or getAnchorDistanceTo(source) > static_cast<Distance>(max_drift_)) {
+        rebuild(source);
+    }
+}
+
+auto MovingRootTree::rebuild(graph::Node anchor) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    rebuilds_++;
+    std::fill(std::begin(anchor_distances_),
+              std::end(anchor_distances_),
+              UNREACHABLE);
+
+    anchor_distances_[graph.nodeToIndex(anchor)] = 0;
+
+    std::vector<Node> queue{anchor};
+    for(std::size_t head = 0; head < queue.size(); head++) {
+        const auto current = queue[head];
+        const auto current_dist = getAnchorDistanceTo(current);
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig) or getAnchorDistanceTo(neig) != UNREACHABLE) {
+                continue;
+            }
+
+            anchor_distances_[graph.nodeToIndex(neig)] = current_dist + 1;
+            queue.emplace_back(neig);
+        }
+    }
+
+    anchor_ = anchor;
+}
+
+auto MovingRootTree::search(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    reset();
+
+    const auto source_idx = graph.nodeToIndex(source);
+    distances_[source_idx] = 0;
+    touched_.emplace_back(source_idx);
+
+    const auto source_h = estimateDistance(source, target);
+    pq_.emplace(source_h, source_h, source);
+
+    while(!pq_.empty()) {
+        const auto [f, h, current] = pq_.top();
+        pq_.pop();
+
+        const auto current_dist = getDistanceTo(current);
+
+        //skip nodes which were expanded since they were queued, the bound
+        //is consistent, so the first expansion of a node is final
+        if(f - h != current_dist) {
+            continue;
+        }
+
+        if(current == target) {
+            return current_dist;
+        }
+
+        expanded_nodes_++;
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            const auto new_dist = current_dist + 1;
+
+            if(new_dist < distances_[neig_idx]) {
+                if(distances_[neig_idx] == UNREACHABLE) {
+                    touched_.emplace_back(neig_idx);
+                }
+
+                distances_[neig_idx] = new_dist;
+                before_[neig_idx] = current;
+
+                const auto neig_h = estimateDistance(neig, target);
+                pq_.emplace(new_dist + neig_h, neig_h, neig);
+            }
+        }
+    }
+
+    return UNREACHABLE;
+}
+
+auto MovingRootTree::estimateDistance(graph::Node from, graph::Node to) const noexcept
+    -> graph::Distance
+{
+    const auto from_anchor = getAnchorDistanceTo(from);
+    const auto to_anchor = getAnchorDistanceTo(to);
+    const auto rows = from.row > to.row ? from.row - to.row : to.row - from.row;
+    const auto columns = from.column > to.column ? from.column - to.column : to.column - from.column;
+
+    return std::max(from_anchor > to_anchor ? from_anchor - to_anchor : to_anchor - from_anchor,
+                    static_cast<Distance>(rows + columns));
+}
+
+auto MovingRootTree::getAnchorDistanceTo(graph::Node n) const noexcept
+    -> graph::Distance
+{
+    return anchor_distances_[graph_.get().nodeToIndex(n)];
+}
+
+auto MovingRootTree::getDistanceTo(graph::Node n) const noexcept
+    -> graph::Distance
+{
+    return distances_[graph_.get().nodeToIndex(n)];
+}
+
+auto MovingRootTree::reset() noexcept
+    -> void
+{
+    for(auto idx : touched_) {
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+    }
+
+    touched_.clear();
+    pq_ = NodeQueue{};
+    expanded_nodes_ = 0;
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <atomic>
+#include <graph/GridGraph.hpp>
+#include <nonstd/span.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/ParallelBfs.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::ParallelBfs;
+
+namespace {
+
+// smaller frontiers are not worth to be split between threads
+constexpr auto FRONTIER_GRAIN_SIZE = 1024ul;
+
+} // namespace
+
+
+ParallelBfs::ParallelBfs(const graph::GridGraph& graph,
+                         std::size_t number_of_threads) noexcept
+    : graph_(graph),
+      number_of_threads_(number_of_threads == 0
+                             ? static_cast<std::size_t>(tbb::this_task_arena::max_concurrency())
+                             : number_of_threads),
+      distances_(graph.size()) {}
+
+auto ParallelBfs::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    search(source, target);
+
+    return distances_[graph.nodeToIndex(target)].load(std::memory_order_relaxed);
+}
+
+auto ParallelBfs::findAllDistances(graph::Node source) noexcept
+    -> std::vector<graph::Distance>
+{
+    std::vector<Distance> distances(graph_.get().size(), UNREACHABLE);
+    findAllDistances(source, distances);
+    return distances;
+}
+
+auto ParallelBfs::findAllDistances(graph::Node source,
+                                   nonstd::span<graph::Distance> distances) noexcept
+    -> void
+{
+    if(graph_.get().isBarrier(source)) {
+        std::fill(std::begin(distances), std::end(distances), UNREACHABLE);
+        return;
+    }
+
+    search(source, graph::NOT_REACHABLE);
+
+    tbb::task_arena arena{static_cast<int>(number_of_threads_)};
+    arena.execute([&] {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>{0, distances_.size()},
+                          [&](const auto& range) {
+                              for(auto i = range.begin(); i != range.end(); i++) {
+                                  distances[i] = distances_[i].load(std::memory_order_relaxed);
+                              }
+                          });
+    });
+}
+
+auto ParallelBfs::getNumberOfThreads() const noexcept
+    -> std::size_t
+{
+    return number_of_threads_;
+}
+
+auto ParallelBfs::search(graph::Node source, graph::Node target) noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto target_idx = target == graph::NOT_REACHABLE
+        ? std::nullopt
+        : std::optional{graph.nodeToIndex(target)};
+
+    tbb::task_arena arena{static_cast<int>(number_of_threads_)};
+    arena.execute([&] {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>{0, distances_.size()},
+                          [&](const auto& range) {
+                              for(auto i = range.begin(); i != range.end(); i++) {
+                                  distances_[i].store(UNREACHABLE, std::memory_order_relaxed);
+                              }
+                          });
+
+        const auto source_idx = graph.nodeToIndex(source);
+        distances_[source_idx].store(0, std::memory_order_relaxed);
+
+        std::vector<std::size_t> frontier{source_idx};
+        tbb::enumerable_thread_specific<std::vector<std::size_t>> next_frontiers;
+        Distance level = 0;
+
+        while(!frontier.empty()) {
+            //all nodes of the current level have their final distance
+            if(target_idx
+               and distances_[target_idx.value()].load(std::memory_order_relaxed) != UNREACHABLE) {
+                return;
+            }
+
+            const Distance next_level = level + 1;
+
+            tbb::parallel_for(tbb::blocked_range<std::size_t>{0, frontier.size(), FRONTIER_GRAIN_SIZE},
+                              [&](const auto& range) {
+                                  auto& next_frontier = next_frontiers.local();
+
+                                  for(auto i = range.begin(); i != range.end(); i++) {
+                                      const auto current = graph.indexToNode(frontier[i]);
+
+                                      for(auto neig : graph.getWalkableNeigbours(current)) {
+                                          //only the thread which sets the distance first
+                                          //adds the node to the next frontier
+                                          const auto neig_idx = graph.nodeToIndex(neig);
+                                          auto expected = UNREACHABLE;
+                                          if(distances_[neig_idx].compare_exchange_strong(expected,
+                                                                                          next_level,
+                                                                                          std::memory_order_relaxed)) {
+                                              next_frontier.emplace_back(neig_idx);
+                                          }
+                                      }
+                                  }
+                              });
+
+            frontier.clear();
+            for(auto& next_frontier : next_frontiers) {
+                frontier.insert(std::end(frontier),
+                                std::begin(next_frontier),
+                                std::end(next_frontier));
+                next_frontier.clear();
+            }
+
+            level = next_level;
+        }
+    });
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/QueryRouter.hpp>
+#include <vector>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::ManhattanHeuristic;
+using pathfinding::QueryRoute;
+using pathfinding::QueryShortcuts;
+
+
+QueryShortcuts::QueryShortcuts(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      last_graph_version_(graph.getVersion())
+{
+    rebuild();
+}
+
+auto QueryShortcuts::findRoute(graph::Node source, graph::Node target) noexcept
+    -> QueryRoute
+{
+    if(graph_.get().getVersion() != last_graph_version_) {
+        last_graph_version_ = graph_.get().getVersion();
+        rebuild();
+    }
+
+    const auto component = getComponent(source);
+    if(component == NO_COMPONENT or component != getComponent(target)) {
+        return QueryRoute::UNREACHABLE;
+    }
+
+    if(ManhattanHeuristic{}.estimateDistance(source, target) == 1) {
+        return QueryRoute::NEIGBOURS;
+    }
+
+    if(isBarrierFree(source, target)) {
+        return QueryRoute::FREE_RECTANGLE;
+    }
+
+    return QueryRoute::FALLBACK;
+}
+
+auto QueryShortcuts::isBarrierFree(graph::Node first, graph::Node second) const noexcept
+    -> bool
+{
+    const auto top = std::min(first.row, second.row);
+    const auto bottom = std::max(first.row, second.row) + 1;
+    const auto left = std::min(first.column, second.column);
+    const auto right = std::max(first.column, second.column) + 1;
+
+    //the sums can wrap around in between, the result is still correct
+    return countBarriers(bottom, right)
+        - countBarriers(top, right)
+        - countBarriers(bottom, left)
+        + countBarriers(top, left)
+        == 0;
+}
+
+auto QueryShortcuts::getComponent(graph::Node n) const noexcept
+    -> std::uint32_t
+{
+    const auto& graph = graph_.get();
+
+    if(graph.isBarrier(n)) {
+        return NO_COMPONENT;
+    }
+
+    return components_[graph.nodeToIndex(n)];
+}
+
+auto QueryShortcuts::rebuild() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto height = graph.getHeight();
+    const auto width = graph.getWidth();
+
+    barriers_.assign((height + 1) * (width + 1), 0);
+    for(std::size_t row = 0; row < height; row++) {
+        for(std::size_t column = 0; column < width; column++) {
+            barriers_[(row + 1) * (width + 1) + column + 1] =
+                graph.isBarrier(Node{row, column})
+                + countBarriers(row, column + 1)
+                + countBarriers(row + 1, column)
+                - countBarriers(row, column);
+        }
+    }
+
+    components_.assign(graph.size(), NO_COMPONENT);
+
+    std::uint32_t number_of_components = 0;
+    std::vector<Node> queue;
+    for(auto root : graph) {
+        if(components_[graph.nodeToIndex(root)] != NO_COMPONENT) {
+            continue;
+        }
+
+        components_[graph.nodeToIndex(root)] = number_of_components;
+        queue.clear();
+        queue.emplace_back(root);
+
+        for(std::size_t head = 0; head < queue.size(); head++) {
+            for(auto neig : graph.getManhattanNeigbours(queue[head])) {
+                if(graph.isBarrier(neig)) {
+                    continue;
+                }
+
+                const auto neig_idx = graph.nodeToIndex(neig);
+
+                if(components_[neig_idx] == NO_COMPONENT) {
+                    components_[neig_idx] = number_of_components;
+                    queue.emplace_back(neig);
+                }
+            }
+        }
+
+        number_of_components++;
+    }
+}
+
+auto QueryShortcuts::countBarriers(std::size_t row, std::size_t column) const noexcept
+    -> std::uint32_t
+{
+    return barriers_[row * (graph_.get().getWidth() + 1) + column];
+}
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <cstdint>
+#include <fmt/core.h>
+#include <fstream>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/RectangleDecomposition.hpp>
+#include <vector>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::Rectangle;
+using pathfinding::RectangleDecomposition;
+
+namespace {
+
+constexpr std::uint64_t FILE_MAGIC = 0x3152535247524947; // "GIRGRSR1"
+
+} // namespace
+
+
+auto Rectangle::getWidth() const noexcept
+    -> std::size_t
+{
+    return right - left + 1;
+}
+
+auto Rectangle::getHeight() const noexcept
+    -> std::size_t
+{
+    return bottom - top + 1;
+}
+
+auto Rectangle::isOnPerimeter(graph::Node n) const noexcept
+    -> bool
+{
+    return n.row == top
+        or n.row == bottom
+        or n.column == left
+        or n.column == right;
+}
+
+
+RectangleDecomposition::RectangleDecomposition(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      rectangle_ids_(graph.size(), NO_RECTANGLE)
+{
+    fmt::print("decomposing the grid into rectangles...\n");
+    decompose();
+}
+
+RectangleDecomposition::RectangleDecomposition(const graph::GridGraph& graph,
+                                               std::vector<Rectangle> rectangles) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      rectangles_(std::move(rectangles)),
+      rectangle_ids_(graph.size(), NO_RECTANGLE) {}
+
+auto RectangleDecomposition::getRectangleOf(graph::Node n) const noexcept
+    -> const Rectangle&
+{
+    return rectangles_[getRectangleIdOf(n)];
+}
+
+auto RectangleDecomposition::getRectangleIdOf(graph::Node n) const noexcept
+    -> RectangleId
+{
+    return rectangle_ids_[graph_.get().nodeToIndex(n)];
+}
+
+auto RectangleDecomposition::isPerimeterNode(graph::Node n) const noexcept
+    -> bool
+{
+    return getRectangleOf(n).isOnPerimeter(n);
+}
+
+auto RectangleDecomposition::getNumberOfRectangles() const noexcept
+    -> std::size_t
+{
+    return rectangles_.size();
+}
+
+auto RectangleDecomposition::countPerimeterNodes() const noexcept
+    -> std::size_t
+{
+    const auto& graph = graph_.get();
+    return std::count_if(std::begin(graph),
+                         std::end(graph),
+                         [&](auto node) {
+                             return isPerimeterNode(node);
+                         });
+}
+
+auto RectangleDecomposition::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto RectangleDecomposition::decompose() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    const auto is_free = [&](std::size_t row, std::size_t column) {
+        const Node node{row, column};
+        return graph.isWalkableNode(node)
+            and rectangle_ids_[graph.nodeToIndex(node)] == NO_RECTANGLE;
+    };
+
+    //greedy: every free node in row major order starts a rectangle which
+    //first grows to the right and then downwards as long as it stays empty
+    for(std::size_t row = 0; row < graph.getHeight(); row++) {
+        for(std::size_t column = 0; column < graph.getWidth(); column++) {
+            if(!is_free(row, column)) {
+                continue;
+            }
+
+            auto right = column;
+            while(is_free(row, right + 1)) {
+                right++;
+            }
+
+            auto bottom = row;
+            while(bottom + 1 < graph.getHeight()) {
+                bool row_is_free = true;
+                for(auto c = column; c <= right and row_is_free; c++) {
+                    row_is_free = is_free(bottom + 1, c);
+                }
+
+                if(!row_is_free) {
+                    break;
+                }
+                bottom++;
+            }
+
+            const auto id = static_cast<RectangleId>(rectangles_.size());
+            rectangles_.emplace_back(Rectangle{static_cast<std::uint32_t>(row),
+                                               static_cast<std::uint32_t>(column),
+                                               static_cast<std::uint32_t>(bottom),
+                                               static_cast<std::uint32_t>(right)});
+
+            for(auto r = row; r <= bottom; r++) {
+                for(auto c = column; c <= right; c++) {
+                    rectangle_ids_[graph.nodeToIndex(Node{r, c})] = id;
+                }
+            }
+        }
+    }
+}
+
+auto RectangleDecomposition::assignRectangles() noexcept
+    -> bool
+{
+    const auto& graph = graph_.get();
+
+    for(RectangleId id = 0; id < rectangles_.size(); id++) {
+        const auto& rect = rectangles_[id];
+        if(rect.top > rect.bottom or rect.left > rect.right) {
+            return false;
+        }
+
+        for(std::size_t r = rect.top; r <= rect.bottom; r++) {
+            for(std::size_t c = rect.left; c <= rect.right; c++) {
+                const Node node{r, c};
+                if(graph.isBarrier(node)) {
+                    return false;
+                }
+
+                auto& node_id = rectangle_ids_[graph.nodeToIndex(node)];
+                if(node_id != NO_RECTANGLE) {
+                    return false;
+                }
+                node_id = id;
+            }
+        }
+    }
+
+    return std::all_of(std::begin(graph),
+                       std::end(graph),
+                       [&](auto node) {
+                           return getRectangleIdOf(node) != NO_RECTANGLE;
+                       });
+}
+
+auto RectangleDecomposition::toFile(std::string_view path) const noexcept
+    -> bool
+{
+    std::ofstream file{path.data(), std::ios::binary};
+
+    const std::uint64_t height = graph_.get().getHeight();
+    const std::uint64_t width = graph_.get().getWidth();
+    const std::uint64_t count = rectangles_.size();
+
+    file.write(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(rectangles_.data()),
+               static_cast<std::streamsize>(rectangles_.size() * sizeof(Rectangle)));
+
+    return !!file;
+}
+
+auto pathfinding::rectangleDecompositionFromFile(const graph::GridGraph& graph,
+                                                 std::string_view path) noexcept
+    -> std::optional<RectangleDecomposition>
+{
+    std::ifstream file{path.data(), std::ios::binary};
+
+    std::uint64_t magic = 0;
+    std::uint64_t height = 0;
+    std::uint64_t width = 0;
+    std::uint64_t count = 0;
+
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&height), sizeof(height));
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    if(!file
+       or magic != FILE_MAGIC
+       or height != graph.getHeight()
+       or width != graph.getWidth()
+       or count > graph.size()) {
+        return std::nullopt;
+    }
+
+    std::vector<Rectangle> rectangles(count);
+    if(!file.read(reinterpret_cast<char*>(rectangles.data()),
+                  static_cast<std::streamsize>(count * sizeof(Rectangle)))) {
+        return std::nullopt;
+    }
+
+    RectangleDecomposition decomposition{graph, std::move(rectangles)};
+    if(!decomposition.assignRectangles()) {
+        return std::nullopt;
+    }
+
+    return decomposition;
+}
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <list>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/SearchTreeCache.hpp>
+#include <unordered_map>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::Path;
+using pathfinding::SearchTreeCache;
+
+
+SearchTreeCache::SearchTreeCache(const graph::GridGraph& graph,
+                                 std::size_t capacity) noexcept
+    : graph_(graph),
+      capacity_(std::max(capacity, std::size_t{1})),
+      last_graph_version_(graph.getVersion()) {}
+
+auto SearchTreeCache::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == findDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    //the tree was just used, so it is the most recently used one
+    const auto& tree = trees_.front();
+
+    //walking to the root of the target tree already yields the right order
+    if(tree.root == target) {
+        return Path{walkToRoot(tree, source)};
+    }
+
+    auto nodes = walkToRoot(tree, target);
+    std::reverse(std::begin(nodes),
+                 std::end(nodes));
+
+    return Path{std::move(nodes)};
+}
+
+auto SearchTreeCache::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    const auto [tree, is_source_tree] = findTree(source, target);
+    const auto other = is_source_tree ? target : source;
+
+    return tree.distances[graph.nodeToIndex(other)];
+}
+
+auto SearchTreeCache::getNumberOfHits() const noexcept
+    -> std::size_t
+{
+    return hits_;
+}
+
+auto SearchTreeCache::getNumberOfMisses() const noexcept
+    -> std::size_t
+{
+    return misses_;
+}
+
+auto SearchTreeCache::getNumberOfCachedTrees() const noexcept
+    -> std::size_t
+{
+    return trees_.size();
+}
+
+auto SearchTreeCache::getCacheSize() const noexcept
+    -> std::size_t
+{
+    return trees_.size()
+        * graph_.get().size()
+        * (sizeof(Distance) + sizeof(Move));
+}
+
+auto SearchTreeCache::clear() noexcept
+    -> void
+{
+    trees_.clear();
+    tree_lookup_.clear();
+}
+
+auto SearchTreeCache::findTree(graph::Node source, graph::Node target) noexcept
+    -> std::pair<const Tree&, bool>
+{
+    //cached trees are outdated if barriers changed since they were computed
+    if(graph_.get().getVersion() != last_graph_version_) {
+        last_graph_version_ = graph_.get().getVersion();
+        clear();
+    }
+
+    for(auto root : {source, target}) {
+        if(auto iter = tree_lookup_.find(root); iter != std::end(tree_lookup_)) {
+            hits_++;
+            trees_.splice(std::begin(trees_), trees_, iter->second);
+            return {trees_.front(), root == source};
+        }
+    }
+
+    misses_++;
+
+    if(trees_.size() == capacity_) {
+        tree_lookup_.erase(trees_.back().root);
+        trees_.pop_back();
+    }
+
+    trees_.emplace_front(computeTree(source));
+    tree_lookup_[source] = std::begin(trees_);
+
+    return {trees_.front(), true};
+}
+
+auto SearchTreeCache::computeTree(graph::Node root) const noexcept
+    -> Tree
+{
+    const auto& graph = graph_.get();
+
+    Tree tree{root,
+              std::vector(graph.size(), UNREACHABLE),
+              std::vector(graph.size(), NO_MOVE)};
+
+    const auto root_idx = graph.nodeToIndex(root);
+    tree.distances[root_idx] = 0;
+
+    //breadth first search, every node remembers the move back to the node
+    //it was discovered from
+    std::vector<std::size_t> queue{root_idx};
+    for(std::size_t head = 0; head < queue.size(); head++) {
+        const auto current_idx = queue[head];
+        const auto neigbours = graph.getManhattanNeigbours(graph.indexToNode(current_idx));
+
+        for(Move move = 0; move < neigbours.size(); move++) {
+            const auto neig = neigbours[move];
+            if(graph.isBarrier(neig)) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(tree.distances[neig_idx] != UNREACHABLE) {
+                continue;
+            }
+
+            //the neigbours are ordered as pairs of opposite moves
+            tree.distances[neig_idx] = tree.distances[current_idx] + 1;
+            tree.moves_to_root[neig_idx] = move ^ 1;
+            queue.emplace_back(neig_idx);
+        }
+    }
+
+    return tree;
+}
+
+auto SearchTreeCache::walkToRoot(const Tree& tree, graph::Node from) const noexcept
+    -> std::vector<graph::Node>
+{
+    const auto& graph = graph_.get();
+
+    std::vector<Node> nodes{from};
+    while(nodes.back() != tree.root) {
+        const auto move = tree.moves_to_root[graph.nodeToIndex(nodes.back())];
+        nodes.emplace_back(graph.getManhattanNeigbours(nodes.back())[move]);
+    }
+
+    return nodes;
+}
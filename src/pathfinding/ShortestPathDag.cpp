@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/ShortestPathDag.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::ShortestPathDag;
+
+
+ShortestPathDag::ShortestPathDag(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      distances_(graph.size(), UNREACHABLE),
+      in_dag_(graph.size(), false) {}
+
+auto ShortestPathDag::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    return computeDag(source, target);
+}
+
+auto ShortestPathDag::findDagNodes(graph::Node source, graph::Node target) noexcept
+    -> std::vector<graph::Node>
+{
+    computeDag(source, target);
+
+    return std::vector(std::rbegin(dag_nodes_),
+                       std::rend(dag_nodes_));
+}
+
+auto ShortestPathDag::findDominators(graph::Node source, graph::Node target) noexcept
+    -> std::vector<graph::Node>
+{
+    computeDag(source, target);
+
+    //the dag nodes are grouped by their layer, starting at the target
+    std::vector<Node> dominators;
+    for(auto layer_begin = std::begin(dag_nodes_); layer_begin != std::end(dag_nodes_);) {
+        const auto layer = getDistanceTo(*layer_begin);
+        const auto layer_end = std::find_if(layer_begin,
+                                            std::end(dag_nodes_),
+                                            [&](auto n) {
+                                                return getDistanceTo(n) != layer;
+                                            });
+
+        if(std::next(layer_begin) == layer_end) {
+            dominators.emplace_back(*layer_begin);
+        }
+
+        layer_begin = layer_end;
+    }
+
+    std::reverse(std::begin(dominators),
+                 std::end(dominators));
+
+    return dominators;
+}
+
+auto ShortestPathDag::computeDag(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    //breadth first search from the source, the touched nodes are the queue.
+    //All nodes up to the layer of the target are settled once the
+    //target is taken from the queue
+    distances_[graph.nodeToIndex(source)] = 0;
+    touched_.emplace_back(source);
+
+    for(std::size_t head = 0; head < touched_.size(); head++) {
+        const auto current = touched_[head];
+        if(current == target) {
+            break;
+        }
+
+        const auto current_dist = getDistanceTo(current);
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig) or getDistanceTo(neig) != UNREACHABLE) {
+                continue;
+            }
+
+            distances_[graph.nodeToIndex(neig)] = current_dist + 1;
+            touched_.emplace_back(neig);
+        }
+    }
+
+    const auto distance = getDistanceTo(target);
+    if(distance == UNREACHABLE) {
+        return UNREACHABLE;
+    }
+
+    //walk the dag backwards, a neigbour one layer closer to the source
+    //is a predecessor of the node on a shortest path
+    in_dag_[graph.nodeToIndex(target)] = true;
+    dag_nodes_.emplace_back(target);
+
+    for(std::size_t head = 0; head < dag_nodes_.size(); head++) {
+        const auto current = dag_nodes_[head];
+        const auto predecessor_dist = getDistanceTo(current) - 1;
+
+        for(auto neig : graph.getManhattanNeigbours(current)) {
+            if(graph.isBarrier(neig) or getDistanceTo(neig) != predecessor_dist) {
+                continue;
+            }
+
+            const auto neig_idx = graph.nodeToIndex(neig);
+            if(!in_dag_[neig_idx]) {
+                in_dag_[neig_idx] = true;
+                dag_nodes_.emplace_back(neig);
+            }
+        }
+    }
+
+    return distance;
+}
+
+auto ShortestPathDag::getDistanceTo(graph::Node n) const noexcept
+    -> graph::Distance
+{
+    return distances_[graph_.get().nodeToIndex(n)];
+}
+
+auto ShortestPathDag::reset() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    for(auto n : touched_) {
+        distances_[graph.nodeToIndex(n)] = UNREACHABLE;
+    }
+
+    for(auto n : dag_nodes_) {
+        in_dag_[graph.nodeToIndex(n)] = false;
+    }
+
+    touched_.clear();
+    dag_nodes_.clear();
+}
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/SubgoalAStar.hpp>
+#include <pathfinding/SubgoalGraph.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::AStar;
+using pathfinding::ManhattanHeuristic;
+using pathfinding::Path;
+using pathfinding::SubgoalAStar;
+using pathfinding::SubgoalGraph;
+
+namespace {
+
+// appends a monotone path from the last node to the target, the target
+// needs to be h-reachable from the last node
+auto refineSegment(const GridGraph& graph,
+                   std::vector<Node>& nodes,
+                   Node target) noexcept
+    -> void
+{
+    const auto from = nodes.back();
+    const auto height = std::max(from.row, target.row) - std::min(from.row, target.row) + 1;
+    const auto width = std::max(from.column, target.column) - std::min(from.column, target.column) + 1;
+
+    const auto toNode = [&](std::size_t i, std::size_t j) {
+        return Node{from.row < target.row ? from.row + i : from.row - i,
+                    from.column < target.column ? from.column + j : from.column - j};
+    };
+
+    //reaches_target[i * width + j] is true if the target can be reached
+    //monotonically from the node i rows and j columns away from the start
+    std::vector<bool> reaches_target(height * width, false);
+    for(auto i = height; i-- > 0;) {
+        for(auto j = width; j-- > 0;) {
+            const auto is_target = i == height - 1 and j == width - 1;
+            const auto next_reaches = (i + 1 < height and reaches_target[(i + 1) * width + j])
+                or (j + 1 < width and reaches_target[i * width + j + 1]);
+
+            reaches_target[i * width + j] = graph.isWalkableNode(toNode(i, j))
+                and (is_target or next_reaches);
+        }
+    }
+
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while(i != height - 1 or j != width - 1) {
+        if(j + 1 < width and reaches_target[i * width + j + 1]) {
+            j++;
+        } else {
+            i++;
+        }
+        nodes.emplace_back(toNode(i, j));
+    }
+}
+
+} // namespace
+
+
+SubgoalAStar::SubgoalAStar(const SubgoalGraph& subgoals) noexcept
+    : subgoals_(subgoals),
+      distances_(subgoals.getNumberOfSubgoals() + 2, UNREACHABLE),
+      before_(subgoals.getNumberOfSubgoals() + 2, graph::NOT_REACHABLE),
+      connected_to_target_(subgoals.getNumberOfSubgoals(), false),
+      pq_(AStarQueueComparer{}) {}
+
+auto SubgoalAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(!subgoals_.get().isUpToDate()) {
+        auto route = getGridSearch().findRoute(source, target);
+        expanded_nodes_ = getGridSearch().getNumberOfExpandedNodes();
+        return route;
+    }
+
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath(source, target);
+}
+
+auto SubgoalAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    if(!subgoals_.get().isUpToDate()) {
+        const auto distance = getGridSearch().findDistance(source, target);
+        expanded_nodes_ = getGridSearch().getNumberOfExpandedNodes();
+        return distance;
+    }
+
+    return computeDistance(source, target);
+}
+
+auto SubgoalAStar::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto SubgoalAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& subgoals = subgoals_.get();
+    const auto& graph = subgoals.getGraph();
+
+    expanded_nodes_ = 0;
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    //a subgoal as target is already part of the subgoal graph
+    if(!subgoals.isSubgoal(target)) {
+        target_subgoals_ = subgoals.findDirectlyReachable(target, source);
+        for(auto node : target_subgoals_) {
+            if(subgoals.isSubgoal(node)) {
+                connected_to_target_[subgoals.getSubgoalId(node)] = true;
+            }
+        }
+    }
+
+    //the subgoal edges are 4-connected paths, so their length is the
+    //manhattan distance whatever neigbours the graph uses
+    const ManhattanHeuristic manhattan;
+
+    const auto source_idx = toIndex(source, source, target);
+    distances_[source_idx] = 0;
+    touched_.emplace_back(source_idx);
+    pq_.emplace(source, Distance{0}, manhattan.estimateDistance(source, target));
+
+    while(!pq_.empty()) {
+        const auto [current, current_dist, _] = pq_.top();
+        pq_.pop();
+
+        //skip outdated queue entries
+        if(current_dist > distances_[toIndex(current, source, target)]) {
+            continue;
+        }
+
+        expanded_nodes_++;
+
+        if(current == target) {
+            return current_dist;
+        }
+
+        const auto visit = [&](auto neig) {
+            const auto neig_idx = toIndex(neig, source, target);
+            const auto new_dist = current_dist + manhattan.estimateDistance(current, neig);
+
+            if(distances_[neig_idx] > new_dist) {
+                if(distances_[neig_idx] == UNREACHABLE) {
+                    touched_.emplace_back(neig_idx);
+                }
+                distances_[neig_idx] = new_dist;
+                before_[neig_idx] = current;
+                pq_.emplace(neig, new_dist, manhattan.estimateDistance(neig, target));
+            }
+        };
+
+        //a source which is no subgoal is connected on the fly
+        if(!subgoals.isSubgoal(current)) {
+            for(auto node : subgoals.findDirectlyReachable(current, target)) {
+                visit(node);
+            }
+            continue;
+        }
+
+        const auto id = subgoals.getSubgoalId(current);
+        for(auto neig_id : subgoals.getNeigbours(id)) {
+            visit(subgoals.getSubgoal(neig_id));
+        }
+
+        if(connected_to_target_[id]) {
+            visit(target);
+        }
+    }
+
+    return UNREACHABLE;
+}
+
+auto SubgoalAStar::toIndex(graph::Node n,
+                           graph::Node source,
+                           graph::Node target) const noexcept
+    -> std::size_t
+{
+    const auto number_of_subgoals = subgoals_.get().getNumberOfSubgoals();
+
+    if(n == source) {
+        return number_of_subgoals;
+    }
+    if(n == target) {
+        return number_of_subgoals + 1;
+    }
+    return subgoals_.get().getSubgoalId(n);
+}
+
+auto SubgoalAStar::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+    -> std::optional<Path>
+{
+    const auto& graph = subgoals_.get().getGraph();
+
+    //subgoals from the target back to the source
+    std::vector<Node> reduced{target};
+    while(reduced.back() != source) {
+        reduced.emplace_back(before_[toIndex(reduced.back(), source, target)]);
+    }
+
+    std::reverse(std::begin(reduced),
+                 std::end(reduced));
+
+    std::vector<Node> nodes{source};
+    for(std::size_t i = 1; i < reduced.size(); i++) {
+        refineSegment(graph, nodes, reduced[i]);
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto SubgoalAStar::reset() noexcept
+    -> void
+{
+    const auto& subgoals = subgoals_.get();
+
+    for(auto idx : touched_) {
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+    }
+
+    for(auto node : target_subgoals_) {
+        if(subgoals.isSubgoal(node)) {
+            connected_to_target_[subgoals.getSubgoalId(node)] = false;
+        }
+    }
+
+    touched_.clear();
+    target_subgoals_.clear();
+    pq_ = AStarQueue{AStarQueueComparer{}};
+}
+
+auto SubgoalAStar::getGridSearch() noexcept
+    -> AStar&
+{
+    if(!grid_search_) {
+        grid_search_.emplace(subgoals_.get().getGraph());
+    }
+
+    return grid_search_.value();
+}
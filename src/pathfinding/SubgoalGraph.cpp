@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <array>
+#include <fmt/core.h>
+#include <graph/GridGraph.hpp>
+#include <nonstd/span.hpp>
+#include <pathfinding/SubgoalGraph.hpp>
+#include <tbb/parallel_for.h>
+#include <vector>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::SubgoalGraph;
+
+namespace {
+
+constexpr std::array QUADRANTS{std::pair{-1l, -1l},
+                               std::pair{-1l, 1l},
+                               std::pair{1l, -1l},
+                               std::pair{1l, 1l}};
+
+// sweeps every quadrant around the node row by row and calls visit for all
+// stop nodes which are reachable on a monotone path, the search does not
+// continue behind stop nodes
+template<class IsStop, class Visitor>
+auto exploreMonotone(const GridGraph& graph,
+                     Node from,
+                     IsStop is_stop,
+                     Visitor visit) noexcept
+    -> void
+{
+    for(auto [row_step, column_step] : QUADRANTS) {
+        //above[j] is true if the j-th node of the last row continues the search
+        std::vector<bool> above;
+        std::vector<bool> current;
+
+        for(std::size_t i = 0;; i++) {
+            const auto row = from.row + static_cast<std::size_t>(row_step * static_cast<long>(i));
+            bool any_reached = false;
+            current.clear();
+
+            for(std::size_t j = 0;; j++) {
+                const auto from_above = i == 0 ? j == 0 : j < above.size() and above[j];
+                const auto from_left = j > 0 and current[j - 1];
+
+                if(!from_above and !from_left) {
+                    if(j >= above.size()) {
+                        break;
+                    }
+                    current.push_back(false);
+                    continue;
+                }
+
+                const auto column = from.column + static_cast<std::size_t>(column_step * static_cast<long>(j));
+                const Node node{row, column};
+
+                if(graph.isBarrier(node)) {
+                    current.push_back(false);
+                    continue;
+                }
+
+                if((i != 0 or j != 0) and is_stop(node)) {
+                    visit(node);
+                    current.push_back(false);
+                    continue;
+                }
+
+                current.push_back(true);
+                any_reached = true;
+            }
+
+            if(!any_reached) {
+                break;
+            }
+
+            std::swap(above, current);
+        }
+    }
+}
+
+} // namespace
+
+
+SubgoalGraph::SubgoalGraph(const graph::GridGraph& graph) noexcept
+    : graph_(graph),
+      graph_version_(graph.getVersion()),
+      subgoal_ids_(graph.size(), NO_SUBGOAL)
+{
+    fmt::print("building subgoal graph...\n");
+    placeSubgoals();
+    connectSubgoals();
+}
+
+auto SubgoalGraph::isSubgoal(graph::Node n) const noexcept
+    -> bool
+{
+    return getSubgoalId(n) != NO_SUBGOAL;
+}
+
+auto SubgoalGraph::getSubgoalId(graph::Node n) const noexcept
+    -> SubgoalId
+{
+    return subgoal_ids_[graph_.get().nodeToIndex(n)];
+}
+
+auto SubgoalGraph::getSubgoal(SubgoalId id) const noexcept
+    -> graph::Node
+{
+    return subgoals_[id];
+}
+
+auto SubgoalGraph::getNeigbours(SubgoalId id) const noexcept
+    -> nonstd::span<const SubgoalId>
+{
+    return nonstd::span<const SubgoalId>{edges_.data() + edge_offsets_[id],
+                                         edges_.data() + edge_offsets_[id + 1]};
+}
+
+auto SubgoalGraph::findDirectlyReachable(graph::Node from, graph::Node target) const noexcept
+    -> std::vector<graph::Node>
+{
+    std::vector<Node> reached;
+
+    exploreMonotone(graph_.get(),
+                    from,
+                    [&](auto node) {
+                        return node == target or isSubgoal(node);
+                    },
+                    [&](auto node) {
+                        reached.emplace_back(node);
+                    });
+
+    //nodes on the axes belong to two quadrants
+    std::sort(std::begin(reached), std::end(reached));
+    reached.erase(std::unique(std::begin(reached), std::end(reached)),
+                  std::end(reached));
+
+    return reached;
+}
+
+auto SubgoalGraph::getNumberOfSubgoals() const noexcept
+    -> std::size_t
+{
+    return subgoals_.size();
+}
+
+auto SubgoalGraph::getNumberOfEdges() const noexcept
+    -> std::size_t
+{
+    return edges_.size() / 2;
+}
+
+auto SubgoalGraph::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return subgoal_ids_.size() * sizeof(SubgoalId)
+        + subgoals_.size() * sizeof(Node)
+        + edge_offsets_.size() * sizeof(std::size_t)
+        + edges_.size() * sizeof(SubgoalId);
+}
+
+auto SubgoalGraph::getGraph() const noexcept
+    -> const graph::GridGraph&
+{
+    return graph_.get();
+}
+
+auto SubgoalGraph::isUpToDate() const noexcept
+    -> bool
+{
+    return graph_.get().getVersion() == graph_version_;
+}
+
+auto SubgoalGraph::isConvexCornerNode(graph::Node n) const noexcept
+    -> bool
+{
+    const auto& graph = graph_.get();
+
+    //a barrier which is a diagonal neigbour while both nodes in between are
+    //walkable has to be walked around, the node is a corner of the detour
+    for(auto [row_step, column_step] : QUADRANTS) {
+        const Node diagonal{n.row + static_cast<std::size_t>(row_step),
+                            n.column + static_cast<std::size_t>(column_step)};
+        const Node vertical{diagonal.row, n.column};
+        const Node horizontal{n.row, diagonal.column};
+
+        if(graph.isBarrier(diagonal)
+           and graph.isWalkableNode(vertical)
+           and graph.isWalkableNode(horizontal)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+auto SubgoalGraph::placeSubgoals() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    for(auto node : graph) {
+        if(isConvexCornerNode(node)) {
+            subgoal_ids_[graph.nodeToIndex(node)] = static_cast<SubgoalId>(subgoals_.size());
+            subgoals_.emplace_back(node);
+        }
+    }
+}
+
+auto SubgoalGraph::connectSubgoals() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    std::vector<std::vector<SubgoalId>> neigbours(subgoals_.size());
+
+    tbb::parallel_for(std::size_t{0},
+                      subgoals_.size(),
+                      [&](auto id) {
+                          auto& subgoal_neigbours = neigbours[id];
+
+                          exploreMonotone(graph,
+                                          subgoals_[id],
+                                          [&](auto node) {
+                                              return isSubgoal(node);
+                                          },
+                                          [&](auto node) {
+                                              subgoal_neigbours.emplace_back(getSubgoalId(node));
+                                          });
+
+                          std::sort(std::begin(subgoal_neigbours),
+                                    std::end(subgoal_neigbours));
+                          subgoal_neigbours.erase(std::unique(std::begin(subgoal_neigbours),
+                                                              std::end(subgoal_neigbours)),
+                                                  std::end(subgoal_neigbours));
+                      });
+
+    edge_offsets_.reserve(subgoals_.size() + 1);
+    for(const auto& subgoal_neigbours : neigbours) {
+        edge_offsets_.emplace_back(edges_.size());
+        edges_.insert(std::end(edges_),
+                      std::begin(subgoal_neigbours),
+                      std::end(subgoal_neigbours));
+    }
+    edge_offsets_.emplace_back(edges_.size());
+}
@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/Distance.hpp>
+#include <pathfinding/RectangleDecomposition.hpp>
+#include <pathfinding/SymmetryReducedAStar.hpp>
+#include <vector>
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using graph::UNREACHABLE;
+using pathfinding::Path;
+using pathfinding::SymmetryReducedAStar;
+
+namespace {
+
+auto manhattanDistance(Node from, Node to) noexcept
+    -> Distance
+{
+    return (std::max(from.row, to.row) - std::min(from.row, to.row))
+        + (std::max(from.column, to.column) - std::min(from.column, to.column));
+}
+
+// appends all nodes of the monotone path from the last node to the target,
+// first along the row and then along the column
+auto walkTo(std::vector<Node>& nodes, Node target) noexcept
+    -> void
+{
+    auto current = nodes.back();
+
+    while(current.column != target.column) {
+        current.column = current.column < target.column
+            ? current.column + 1
+            : current.column - 1;
+        nodes.emplace_back(current);
+    }
+
+    while(current.row != target.row) {
+        current.row = current.row < target.row
+            ? current.row + 1
+            : current.row - 1;
+        nodes.emplace_back(current);
+    }
+}
+
+} // namespace
+
+
+SymmetryReducedAStar::SymmetryReducedAStar(const graph::GridGraph& graph,
+                                           const RectangleDecomposition& rectangles) noexcept
+    : graph_(graph),
+      rectangles_(rectangles),
+      distances_(graph.size(), UNREACHABLE),
+      before_(graph.size(), graph::NOT_REACHABLE),
+      pq_(AStarQueueComparer{}) {}
+
+auto SymmetryReducedAStar::findRoute(graph::Node source, graph::Node target) noexcept
+    -> std::optional<Path>
+{
+    if(UNREACHABLE == computeDistance(source, target)) {
+        return std::nullopt;
+    }
+
+    return extractShortestPath(source, target);
+}
+
+auto SymmetryReducedAStar::findDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    return computeDistance(source, target);
+}
+
+auto SymmetryReducedAStar::getNumberOfExpandedNodes() const noexcept
+    -> std::size_t
+{
+    return expanded_nodes_;
+}
+
+auto SymmetryReducedAStar::computeDistance(graph::Node source, graph::Node target) noexcept
+    -> graph::Distance
+{
+    const auto& graph = graph_.get();
+
+    expanded_nodes_ = 0;
+    reset();
+
+    if(graph.isBarrier(source) or graph.isBarrier(target)) {
+        return UNREACHABLE;
+    }
+
+    const auto source_idx = graph.nodeToIndex(source);
+    distances_[source_idx] = 0;
+    touched_.emplace_back(source);
+    pq_.emplace(source, Distance{0}, manhattanDistance(source, target));
+
+    while(!pq_.empty()) {
+        const auto [current, current_dist, _] = pq_.top();
+        pq_.pop();
+
+        //skip outdated queue entries
+        if(current_dist > distances_[graph.nodeToIndex(current)]) {
+            continue;
+        }
+
+        expanded_nodes_++;
+
+        if(current == target) {
+            return current_dist;
+        }
+
+        forEachSuccessor(current,
+                         target,
+                         [&](auto neig, auto distance) {
+                             const auto neig_idx = graph.nodeToIndex(neig);
+                             const Distance new_dist = current_dist + distance;
+
+                             if(distances_[neig_idx] > new_dist) {
+                                 if(distances_[neig_idx] == UNREACHABLE) {
+                                     touched_.emplace_back(neig);
+                                 }
+                                 distances_[neig_idx] = new_dist;
+                                 before_[neig_idx] = current;
+                                 pq_.emplace(neig, new_dist, manhattanDistance(neig, target));
+                             }
+                         });
+    }
+
+    return UNREACHABLE;
+}
+
+template<class Visitor>
+auto SymmetryReducedAStar::forEachSuccessor(graph::Node n,
+                                            graph::Node target,
+                                            Visitor visit) const noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+    const auto& rectangles = rectangles_.get();
+
+    //the rectangles of an outdated decomposition can contain barriers
+    if(!rectangles.isUpToDate()) {
+        for(auto neig : graph.getManhattanNeigbours(n)) {
+            if(graph.isWalkableNode(neig)) {
+                visit(neig, Distance{1});
+            }
+        }
+        return;
+    }
+
+    const auto& rect = rectangles.getRectangleOf(n);
+    const auto same_rectangle_as_target =
+        rectangles.getRectangleIdOf(n) == rectangles.getRectangleIdOf(target);
+
+    //inside of one empty rectangle the manhattan distance is exact, so the
+    //target is connected to every node of its rectangle
+    if(same_rectangle_as_target) {
+        visit(target, manhattanDistance(n, target));
+    }
+
+    //an interior source leaves its rectangle over one of its projections
+    if(!rect.isOnPerimeter(n)) {
+        for(auto projection : getProjections(n)) {
+            visit(projection, manhattanDistance(n, projection));
+        }
+        return;
+    }
+
+    //no path over another node can be shorter than the direct edge
+    if(same_rectangle_as_target and !rect.isOnPerimeter(target)) {
+        return;
+    }
+
+    for(auto neig : graph.getManhattanNeigbours(n)) {
+        if(graph.isWalkableNode(neig) and rectangles.isPerimeterNode(neig)) {
+            visit(neig, Distance{1});
+        }
+    }
+
+    //macro edges to the opposite side of the rectangle, on the top and
+    //bottom row the perimeter itself already is the straight path
+    if(rect.getWidth() > 2 and n.row != rect.top and n.row != rect.bottom) {
+        if(n.column == rect.left) {
+            visit(Node{n.row, rect.right}, static_cast<Distance>(rect.getWidth() - 1));
+        }
+        if(n.column == rect.right) {
+            visit(Node{n.row, rect.left}, static_cast<Distance>(rect.getWidth() - 1));
+        }
+    }
+
+    if(rect.getHeight() > 2 and n.column != rect.left and n.column != rect.right) {
+        if(n.row == rect.top) {
+            visit(Node{rect.bottom, n.column}, static_cast<Distance>(rect.getHeight() - 1));
+        }
+        if(n.row == rect.bottom) {
+            visit(Node{rect.top, n.column}, static_cast<Distance>(rect.getHeight() - 1));
+        }
+    }
+}
+
+auto SymmetryReducedAStar::getProjections(graph::Node n) const noexcept
+    -> std::array<graph::Node, 4>
+{
+    const auto& rect = rectangles_.get().getRectangleOf(n);
+
+    return std::array{Node{n.row, rect.left},
+                      Node{n.row, rect.right},
+                      Node{rect.top, n.column},
+                      Node{rect.bottom, n.column}};
+}
+
+auto SymmetryReducedAStar::extractShortestPath(graph::Node source, graph::Node target) const noexcept
+    -> std::optional<Path>
+{
+    const auto& graph = graph_.get();
+
+    //nodes of the reduced graph from the target back to the source
+    std::vector<Node> reduced{target};
+    while(reduced.back() != source) {
+        reduced.emplace_back(before_[graph.nodeToIndex(reduced.back())]);
+    }
+
+    std::reverse(std::begin(reduced),
+                 std::end(reduced));
+
+    //macro edges and on the fly edges stay inside of one empty rectangle,
+    //so every monotone walk between their ends is a valid path
+    std::vector<Node> nodes{source};
+    for(std::size_t i = 1; i < reduced.size(); i++) {
+        walkTo(nodes, reduced[i]);
+    }
+
+    return Path{std::move(nodes)};
+}
+
+auto SymmetryReducedAStar::reset() noexcept
+    -> void
+{
+    const auto& graph = graph_.get();
+
+    for(auto n : touched_) {
+        const auto idx = graph.nodeToIndex(n);
+        distances_[idx] = UNREACHABLE;
+        before_[idx] = graph::NOT_REACHABLE;
+    }
+
+    touched_.clear();
+    pq_ = AStarQueue{AStarQueueComparer{}};
+}
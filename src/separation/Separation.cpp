@@ -356,7 +356,7 @@ auto separation::fromFile(std::string_view path) noexcept
 
         auto first_center = parseNode(first_center_str);
         auto second_center = parseNode(second_center_str);
-        auto distance = std::stol(distance_str);
+        auto distance = static_cast<graph::Distance>(std::stol(distance_str));
 
         return Separation{first_cluster,
                           second_cluster,
@@ -1,6 +1,7 @@
 #include <fmt/ostream.h>
 #include <graph/GridGraph.hpp>
 #include <graph/Node.hpp>
+#include <numeric>
 #include <separation/Separation.hpp>
 #include <separation/SeparationDistanceOracle.hpp>
 #include <vector>
@@ -85,6 +86,17 @@ auto SeparationDistanceOracle::findDistance(graph::Node from, graph::Node to) co
     return graph_.getTrivialDistance(from, to);
 }
 
+auto SeparationDistanceOracle::getIndexSize() const noexcept
+    -> std::size_t
+{
+    return std::accumulate(std::cbegin(separation_lookup_),
+                           std::cend(separation_lookup_),
+                           separation_lookup_.capacity() * sizeof(std::vector<Separation>),
+                           [](auto init, const auto& separations) {
+                               return init + separations.capacity() * sizeof(Separation);
+                           });
+}
+
 namespace {
 
 auto PrivateBinarySearch(const std::vector<Separation>& vec, int l, int r, int index, Node value) -> Separation
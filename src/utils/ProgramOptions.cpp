@@ -1,11 +1,13 @@
 #include <CLI/CLI.hpp>
 #include <optional>
+#include <pathfinding/Landmarks.hpp>
 #include <string>
 #include <string_view>
 #include <utils/ProgramOptions.hpp>
 
 using utils::ProgramOptions;
 using utils::RunningMode;
+using pathfinding::LandmarkStrategy;
 using std::string_literals::operator""s;
 
 
@@ -13,11 +15,17 @@ using std::string_literals::operator""s;
 ProgramOptions::ProgramOptions(std::string graph_file,
                                NeigbourMetric neigbour_mode,
                                RunningMode running_mode,
-                               std::optional<std::string> separation_folder)
+                               std::optional<std::string> separation_folder,
+                               std::size_t number_of_landmarks,
+                               LandmarkStrategy landmark_strategy,
+                               std::optional<std::size_t> memory_limit)
     : graph_file_(std::move(graph_file)),
       neigbour_mode_(neigbour_mode),
       running_mode_(running_mode),
-      separation_folder_(std::move(separation_folder)) {}
+      separation_folder_(std::move(separation_folder)),
+      number_of_landmarks_(number_of_landmarks),
+      landmark_strategy_(landmark_strategy),
+      memory_limit_(memory_limit) {}
 
 auto ProgramOptions::getGraphFile() const noexcept
     -> std::string_view
@@ -42,6 +50,12 @@ auto ProgramOptions::getNeigbourCalculator() const noexcept
     }
 }
 
+auto ProgramOptions::getNeigbourMetric() const noexcept
+    -> NeigbourMetric
+{
+    return neigbour_mode_;
+}
+
 auto ProgramOptions::hasSeparationFolder() const noexcept
     -> bool
 {
@@ -54,21 +68,55 @@ auto ProgramOptions::getSeparationFolder() const noexcept
     return separation_folder_.value();
 }
 
+auto ProgramOptions::getNumberOfLandmarks() const noexcept
+    -> std::size_t
+{
+    return number_of_landmarks_;
+}
+
+auto ProgramOptions::getLandmarkStrategy() const noexcept
+    -> LandmarkStrategy
+{
+    return landmark_strategy_;
+}
+
+auto ProgramOptions::getMemoryLimit() const noexcept
+    -> std::optional<std::size_t>
+{
+    return memory_limit_;
+}
+
 
 auto utils::parseArguments(int argc, char* argv[])
     -> ProgramOptions
 {
     CLI::App app{"Grid-Graph Path Finder"};
     static const std::unordered_map mode_map{std::pair{"separation"s, RunningMode::SEPARATION},
-                                             std::pair{"selection"s, RunningMode::SELECTION}};
+                                             std::pair{"selection"s, RunningMode::SELECTION},
+                                             std::pair{"landmarks"s, RunningMode::LANDMARKS},
+                                             std::pair{"cpd"s, RunningMode::CPD},
+                                             std::pair{"replanning"s, RunningMode::REPLANNING},
+                                             std::pair{"rsr"s, RunningMode::RSR},
+                                             std::pair{"subgoals"s, RunningMode::SUBGOALS},
+                                             std::pair{"scaling"s, RunningMode::SCALING},
+                                             std::pair{"blocks"s, RunningMode::BLOCKS},
+                                             std::pair{"hierarchy"s, RunningMode::HIERARCHY},
+                                             std::pair{"tune"s, RunningMode::TUNING},
+                                             std::pair{"octile"s, RunningMode::OCTILE}};
 
     static const std::unordered_map neigbour_map{std::pair{"manhattan"s, NeigbourMetric::MANHATTAN},
                                                  std::pair{"all-sourounding"s, NeigbourMetric::ALL_SURROUNDING}};
 
+    static const std::unordered_map landmark_strategy_map{std::pair{"farthest"s, LandmarkStrategy::FARTHEST},
+                                                          std::pair{"avoid"s, LandmarkStrategy::AVOID}};
+
     std::string graph_file;
     std::string separation_folder;
     auto mode = RunningMode::SEPARATION;
     auto neigbours = NeigbourMetric::MANHATTAN;
+    std::size_t number_of_landmarks = 16;
+    auto landmark_strategy = LandmarkStrategy::AVOID;
+    std::size_t memory_limit = 0;
 
     app.add_option("-g,--graph",
                    graph_file,
@@ -92,6 +140,21 @@ auto utils::parseArguments(int argc, char* argv[])
                    "neigbour mode")
         ->transform(CLI::CheckedTransformer(neigbour_map, CLI::ignore_case));
 
+    app.add_option("-l,--landmarks",
+                   number_of_landmarks,
+                   "number of landmarks used by the ALT heuristic")
+        ->check(CLI::PositiveNumber);
+
+    app.add_option("--landmark-strategy",
+                   landmark_strategy,
+                   "landmark selection strategy")
+        ->transform(CLI::CheckedTransformer(landmark_strategy_map, CLI::ignore_case));
+
+    app.add_option("--memory-limit",
+                   memory_limit,
+                   "MiB the engine recommended by the tuning profile may use")
+        ->check(CLI::PositiveNumber);
+
     try {
         app.parse(argc, argv);
     } catch(const CLI::ParseError& e) {
@@ -103,5 +166,10 @@ auto utils::parseArguments(int argc, char* argv[])
                           mode,
                           separation_folder.empty()
                               ? std::optional<std::string>()
-                              : std::optional<std::string>(separation_folder)};
+                              : std::optional<std::string>(separation_folder),
+                          number_of_landmarks,
+                          landmark_strategy,
+                          memory_limit == 0
+                              ? std::optional<std::size_t>()
+                              : std::optional<std::size_t>(memory_limit * 1024 * 1024)};
 }
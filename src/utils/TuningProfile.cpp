@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <graph/GridGraph.hpp>
+#include <optional>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <random>
+#include <separation/SeparationDistanceOracle.hpp>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <utils/Timer.hpp>
+#include <utils/TuningProfile.hpp>
+#include <vector>
+
+using graph::GridGraph;
+using graph::Node;
+using utils::EngineCalibration;
+using utils::TunedEngine;
+using utils::TuningProfile;
+
+namespace {
+
+constexpr std::uint64_t FILE_MAGIC = 0x3350545247524947; // "GIRGRTP3"
+
+// query times which differ by less than this factor are treated as equal
+constexpr auto QUERY_TIME_TOLERANCE = 1.1;
+
+template<class Factory>
+auto calibrate(TunedEngine engine,
+               const std::vector<std::pair<Node, Node>>& queries,
+               Factory&& make_path_finder) noexcept
+    -> EngineCalibration
+{
+    utils::Timer t;
+    auto path_finder = make_path_finder();
+    const auto preprocessing_time = t.elapsed();
+
+    t.reset();
+    for(auto [source, target] : queries) {
+        [[maybe_unused]] const auto distance = path_finder.findDistance(source, target);
+    }
+    const auto total_time = t.elapsed();
+
+    //the oracle keeps no state per query, the searches keep no index
+    const auto memory_usage = [&]() -> std::size_t {
+        if constexpr(std::is_same_v<decltype(path_finder), separation::SeparationDistanceOracle>) {
+            return path_finder.getIndexSize();
+        } else {
+            return path_finder.getMemoryUsage();
+        }
+    }();
+
+    return EngineCalibration{engine,
+                             preprocessing_time,
+                             queries.empty() ? 0.0 : total_time / static_cast<double>(queries.size()),
+                             memory_usage};
+}
+
+} // namespace
+
+
+auto utils::toString(TunedEngine engine) noexcept
+    -> std::string_view
+{
+    switch(engine) {
+    case TunedEngine::ASTAR:
+        return "a*";
+    case TunedEngine::SEPARATION_ORACLE:
+        return "separation oracle";
+    default:
+        return "dijkstra";
+    }
+}
+
+TuningProfile::TuningProfile(const graph::GridGraph& graph,
+                             std::vector<EngineCalibration> calibrations) noexcept
+    : graph_(graph),
+      calibrations_(std::move(calibrations)) {}
+
+auto TuningProfile::getRecommendedEngine(std::optional<std::size_t> memory_limit) const noexcept
+    -> TunedEngine
+{
+    const auto by_memory = [](const auto& lhs, const auto& rhs) {
+        return lhs.memory_usage < rhs.memory_usage;
+    };
+
+    std::vector<EngineCalibration> fitting;
+    std::copy_if(std::begin(calibrations_),
+                 std::end(calibrations_),
+                 std::back_inserter(fitting),
+                 [&](const auto& calibration) {
+                     return !memory_limit or calibration.memory_usage <= memory_limit.value();
+                 });
+
+    if(fitting.empty()) {
+        const auto smallest = std::min_element(std::begin(calibrations_),
+                                               std::end(calibrations_),
+                                               by_memory);
+
+        return smallest == std::end(calibrations_)
+            ? TunedEngine::DIJKSTRA
+            : smallest->engine;
+    }
+
+    const auto fastest = std::min_element(std::begin(fitting),
+                                          std::end(fitting),
+                                          [](const auto& lhs, const auto& rhs) {
+                                              return lhs.query_time < rhs.query_time;
+                                          });
+
+    //nearly as fast engines win if they need less memory
+    const auto max_query_time = fastest->query_time * QUERY_TIME_TOLERANCE;
+    fitting.erase(std::remove_if(std::begin(fitting),
+                                 std::end(fitting),
+                                 [&](const auto& calibration) {
+                                     return calibration.query_time > max_query_time;
+                                 }),
+                  std::end(fitting));
+
+    return std::min_element(std::begin(fitting),
+                            std::end(fitting),
+                            by_memory)
+        ->engine;
+}
+
+auto TuningProfile::getCalibrations() const noexcept
+    -> const std::vector<EngineCalibration>&
+{
+    return calibrations_;
+}
+
+auto TuningProfile::toFile(std::string_view path) const noexcept
+    -> bool
+{
+    std::ofstream file{path.data(), std::ios::binary};
+
+    const std::uint64_t height = graph_.get().getHeight();
+    const std::uint64_t width = graph_.get().getWidth();
+    const std::uint64_t layout = graph_.get().hashBarrierLayout();
+    const std::uint64_t count = calibrations_.size();
+
+    file.write(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&layout), sizeof(layout));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    for(const auto& calibration : calibrations_) {
+        const std::uint64_t memory_usage = calibration.memory_usage;
+
+        file.write(reinterpret_cast<const char*>(&calibration.engine), sizeof(calibration.engine));
+        file.write(reinterpret_cast<const char*>(&calibration.preprocessing_time), sizeof(calibration.preprocessing_time));
+        file.write(reinterpret_cast<const char*>(&calibration.query_time), sizeof(calibration.query_time));
+        file.write(reinterpret_cast<const char*>(&memory_usage), sizeof(memory_usage));
+    }
+
+    return !!file;
+}
+
+auto utils::tuningProfileFromFile(const graph::GridGraph& graph,
+                                  std::string_view path) noexcept
+    -> std::optional<TuningProfile>
+{
+    std::ifstream file{path.data(), std::ios::binary};
+
+    std::uint64_t magic = 0;
+    std::uint64_t height = 0;
+    std::uint64_t width = 0;
+    std::uint64_t layout = 0;
+    std::uint64_t count = 0;
+
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&height), sizeof(height));
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&layout), sizeof(layout));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    //a map with other barriers may prefer another engine
+    if(!file
+       or magic != FILE_MAGIC
+       or height != graph.getHeight()
+       or width != graph.getWidth()
+       or layout != graph.hashBarrierLayout()
+       or count > 3) {
+        return std::nullopt;
+    }
+
+    std::vector<EngineCalibration> calibrations(count);
+    for(auto& calibration : calibrations) {
+        std::uint64_t memory_usage = 0;
+
+        file.read(reinterpret_cast<char*>(&calibration.engine), sizeof(calibration.engine));
+        file.read(reinterpret_cast<char*>(&calibration.preprocessing_time), sizeof(calibration.preprocessing_time));
+        file.read(reinterpret_cast<char*>(&calibration.query_time), sizeof(calibration.query_time));
+        file.read(reinterpret_cast<char*>(&memory_usage), sizeof(memory_usage));
+
+        if(!file or calibration.engine > TunedEngine::SEPARATION_ORACLE) {
+            return std::nullopt;
+        }
+
+        calibration.memory_usage = memory_usage;
+    }
+
+    return TuningProfile{graph, std::move(calibrations)};
+}
+
+auto utils::calibrateEngines(const graph::GridGraph& graph,
+                             const std::vector<separation::Separation>& separations,
+                             std::size_t number_of_queries,
+                             std::uint64_t seed) noexcept
+    -> TuningProfile
+{
+    std::vector<Node> nodes;
+    for(auto n : graph) {
+        nodes.emplace_back(n);
+    }
+
+    //every engine answers the same queries
+    std::vector<std::pair<Node, Node>> queries;
+    if(!nodes.empty()) {
+        std::mt19937_64 gen{seed};
+        std::uniform_int_distribution<std::size_t> node_dist{0, nodes.size() - 1};
+
+        for(std::size_t i{0}; i < number_of_queries; i++) {
+            //drawn one after another, the order of arguments is unspecified
+            const auto source = nodes[node_dist(gen)];
+            const auto target = nodes[node_dist(gen)];
+            queries.emplace_back(source, target);
+        }
+    }
+
+    std::vector<EngineCalibration> calibrations;
+
+    calibrations.emplace_back(
+        calibrate(TunedEngine::DIJKSTRA,
+                  queries,
+                  [&] { return pathfinding::DistanceGridGraphDijkstra{graph}; }));
+
+    calibrations.emplace_back(
+        calibrate(TunedEngine::ASTAR,
+                  queries,
+                  [&] { return pathfinding::DistanceAStar{graph}; }));
+
+    if(!separations.empty()) {
+        calibrations.emplace_back(
+            calibrate(TunedEngine::SEPARATION_ORACLE,
+                      queries,
+                      [&] { return separation::SeparationDistanceOracle{graph, separations}; }));
+    }
+
+    return TuningProfile{graph, std::move(calibrations)};
+}
@@ -0,0 +1,182 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <future>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/AsyncQueryEngine.hpp>
+#include <pathfinding/CancellationToken.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::AsyncQueryEngine;
+using pathfinding::CancellationToken;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::GridGraphDijkstra;
+
+namespace {
+
+std::promise<void> search_started;
+std::promise<void> search_released;
+
+// the first search waits until the test releases it, so the test controls
+// when the worker takes the next query
+class BlockingSearch
+{
+public:
+    BlockingSearch(const GridGraph& /*graph*/) noexcept {}
+
+    auto setCancellationToken(std::optional<CancellationToken> /*token*/) noexcept
+        -> void {}
+
+    [[nodiscard]] auto findDistance(Node source, Node target) noexcept
+        -> graph::Distance
+    {
+        if(!started_) {
+            started_ = true;
+            search_started.set_value();
+            search_released.get_future().wait();
+        }
+
+        return static_cast<graph::Distance>(source.row > target.row
+                                                ? source.row - target.row
+                                                : target.row - source.row);
+    }
+
+private:
+    bool started_ = false;
+};
+
+} // namespace
+
+
+TEST(AsyncQueryEngineTest, AsyncQueryEngineWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    GridGraphDijkstra d{graph_test1};
+    AsyncQueryEngine<AStar> engine{graph_test1, 2, 2 * graph_test1.size()};
+
+    for(auto from : graph_test1) {
+        std::vector<std::pair<Node, AsyncQueryEngine<AStar>::DistanceHandle>> distance_handles;
+        std::vector<std::pair<Node, AsyncQueryEngine<AStar>::RouteHandle>> route_handles;
+
+        for(auto to : graph_test1) {
+            auto distance_handle = engine.findDistance(from, to);
+            auto route_handle = engine.findRoute(from, to);
+
+            //the queue is large enough for all queries with the same source
+            ASSERT_TRUE(distance_handle);
+            ASSERT_TRUE(route_handle);
+
+            distance_handles.emplace_back(to, std::move(distance_handle.value()));
+            route_handles.emplace_back(to, std::move(route_handle.value()));
+        }
+
+        for(auto& [to, handle] : distance_handles) {
+            EXPECT_EQ(handle.result.get(), d.findDistance(from, to));
+        }
+
+        for(auto& [to, handle] : route_handles) {
+            const auto expected = d.findDistance(from, to);
+            const auto path = handle.result.get();
+            ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+            if(path) {
+                EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            }
+        }
+    }
+}
+
+TEST(AsyncQueryEngineTest, CancelledSearchTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    DistanceGridGraphDijkstra d{graph_test1};
+    AStar astar{graph_test1};
+
+    CancellationToken token;
+    d.setCancellationToken(token);
+    astar.setCancellationToken(token);
+
+    EXPECT_EQ(d.findDistance(Node{0, 0}, Node{19, 19}), 38);
+
+    //copies of a token share the cancellation
+    CancellationToken{token}.cancel();
+    EXPECT_TRUE(token.isCancelled());
+
+    //answers from the complete tree of the last query need no search
+    EXPECT_EQ(d.findDistance(Node{0, 0}, Node{10, 10}), 20);
+
+    EXPECT_EQ(d.findDistance(Node{1, 1}, Node{10, 10}), graph::UNREACHABLE);
+    EXPECT_EQ(astar.findDistance(Node{1, 1}, Node{10, 10}), graph::UNREACHABLE);
+    EXPECT_FALSE(astar.findRoute(Node{1, 1}, Node{10, 10}));
+
+    //the searches which were cancelled do not leave broken trees behind
+    d.setCancellationToken(std::nullopt);
+    astar.setCancellationToken(std::nullopt);
+    EXPECT_EQ(d.findDistance(Node{1, 1}, Node{10, 10}), 18);
+    EXPECT_EQ(astar.findDistance(Node{1, 1}, Node{10, 10}), 18);
+}
+
+TEST(AsyncQueryEngineTest, BackpressureAndCancellationTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    search_started = std::promise<void>{};
+    search_released = std::promise<void>{};
+
+    std::vector<AsyncQueryEngine<BlockingSearch>::DistanceHandle> handles;
+    std::size_t rejected = 0;
+
+    {
+        AsyncQueryEngine<BlockingSearch> engine{graph_test1, 1, 4};
+
+        //the only worker blocks on the first query, so the queue stays full
+        auto running = engine.findDistance(Node{0, 0}, Node{19, 19});
+        ASSERT_TRUE(running);
+        search_started.get_future().wait();
+
+        for(std::size_t i = 0; i < 10; i++) {
+            auto handle = engine.findDistance(Node{0, i}, Node{19, i});
+            if(handle) {
+                handles.emplace_back(std::move(handle.value()));
+            } else {
+                rejected++;
+            }
+        }
+
+        EXPECT_EQ(handles.size(), 4);
+        EXPECT_EQ(rejected, 6);
+        EXPECT_EQ(engine.getNumberOfQueuedQueries(), 4);
+        EXPECT_EQ(engine.getNumberOfRejectedQueries(), 6);
+
+        //cancelled queries finish without a result, even the running one
+        handles.front().token.cancel();
+        running->token.cancel();
+        search_released.set_value();
+
+        EXPECT_FALSE(running->result.get());
+        EXPECT_FALSE(handles.front().result.get());
+
+        //the engine cancels and finishes all remaining queries when it is destroyed
+    }
+
+    for(std::size_t i = 1; i < handles.size(); i++) {
+        const auto result = handles[i].result.get();
+        if(result) {
+            EXPECT_EQ(result.value(), 19);
+        }
+    }
+}
@@ -0,0 +1,247 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/BlockAStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/LocalDistanceDatabase.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::BlockAStar;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::LocalDistanceDatabase;
+
+
+TEST(BlockAStarTest, LocalDistanceDatabaseTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    //all inner blocks have the same pattern, the blocks at the right and the
+    //bottom border are padded with barriers
+    const LocalDistanceDatabase database{graph_test1, 8};
+    EXPECT_EQ(database.getNumberOfBlocks(), 9u);
+    EXPECT_EQ(database.getNumberOfPatterns(), 4u);
+    EXPECT_EQ(database.getPerimeter().size(), 28u);
+
+    const auto cell = database.getBlockCell(database.getBlockOf(Node{19, 19}));
+    EXPECT_EQ(cell.getHeight(), 4u);
+    EXPECT_EQ(cell.getWidth(), 4u);
+    EXPECT_TRUE(cell.isInCell(Node{16, 16}));
+
+    //opposite corners of a free block
+    const auto top_left = database.getPerimeterIndex(Node{0, 0}).value();
+    const auto bottom_right = database.getPerimeterIndex(Node{7, 7}).value();
+    EXPECT_EQ(database.getLocalDistance(0, top_left, bottom_right), 14);
+    EXPECT_FALSE(database.getPerimeterIndex(Node{3, 3}));
+
+    //a wall through the block separates its perimeter
+    for(std::size_t row = 0; row < 8; row++) {
+        graph_test1.setBarrier(Node{row, 4}, true);
+    }
+    const LocalDistanceDatabase walled{graph_test1, 8};
+    EXPECT_EQ(walled.getNumberOfPatterns(), 5u);
+    EXPECT_EQ(walled.getLocalDistance(0, top_left, bottom_right), graph::UNREACHABLE);
+}
+
+TEST(BlockAStarTest, RandomGridTest)
+{
+    std::mt19937 gen{13};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    std::vector grid(37, std::vector(45, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    std::vector<Node> nodes;
+    for(auto n : graph) {
+        nodes.emplace_back(n);
+    }
+
+    DistanceGridGraphDijkstra d{graph};
+
+    for(std::size_t block_size : {2, 5, 8}) {
+        const LocalDistanceDatabase database{graph, block_size};
+        BlockAStar astar{database};
+
+        for(std::size_t i = 0; i < nodes.size(); i += 23) {
+            for(std::size_t j = 0; j < nodes.size(); j += 7) {
+                const auto source = nodes[i];
+                const auto target = nodes[j];
+                const auto expected = d.findDistance(source, target);
+
+                ASSERT_EQ(astar.findDistance(source, target), expected);
+
+                const auto route = astar.findRoute(source, target);
+                if(expected == graph::UNREACHABLE) {
+                    EXPECT_FALSE(route);
+                    continue;
+                }
+
+                ASSERT_TRUE(route);
+                EXPECT_EQ(static_cast<graph::Distance>(route->getLength()), expected);
+                EXPECT_EQ(route->getSource(), source);
+                EXPECT_EQ(route->getTarget(), target);
+
+                const auto& path = route->getNodes();
+                for(std::size_t k = 1; k < path.size(); k++) {
+                    EXPECT_TRUE(graph.areNeighbours(path[k - 1], path[k]));
+                    EXPECT_FALSE(graph.isBarrier(path[k]));
+                }
+            }
+        }
+    }
+}
+
+TEST(BlockAStarTest, ExpandedBlocksTest)
+{
+    std::vector test1(64, std::vector(64, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const LocalDistanceDatabase database{graph_test1, 8};
+    EXPECT_EQ(database.getNumberOfPatterns(), 1u);
+
+    BlockAStar astar{database};
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{63, 63}), 126);
+
+    //ties are broken towards the target, so on a free grid only the blocks
+    //along one monotone staircase of blocks are expanded
+    EXPECT_GT(astar.getNumberOfExpandedBlocks(), 0u);
+    EXPECT_LT(astar.getNumberOfExpandedBlocks(), 2 * 8u);
+    EXPECT_EQ(astar.findDistance(Node{5, 5}, Node{5, 5}), 0);
+}
+
+TEST(BlockAStarTest, DetourThroughOtherBlocksTest)
+{
+    std::vector test1(24, std::vector(24, true));
+
+    //a wall splits the top left block, the middle block is solid
+    for(std::size_t row = 0; row < 8; row++) {
+        test1[row][4] = false;
+    }
+    for(std::size_t row = 8; row < 16; row++) {
+        for(std::size_t column = 8; column < 16; column++) {
+            test1[row][column] = false;
+        }
+    }
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const LocalDistanceDatabase database{graph_test1, 8};
+    EXPECT_EQ(database.getNumberOfBlocks(), 9u);
+    EXPECT_EQ(database.getNumberOfPatterns(), 3u);
+
+    BlockAStar astar{database};
+    DistanceGridGraphDijkstra d{graph_test1};
+
+    //both sides of the wall are in the same block, the path leaves the
+    //block and enters it again from below
+    const Node left{0, 0};
+    const Node right{0, 7};
+    EXPECT_EQ(astar.findDistance(left, right), 23);
+    EXPECT_GT(astar.getNumberOfExpandedBlocks(), 1u);
+
+    const auto route = astar.findRoute(left, right);
+    ASSERT_TRUE(route);
+    EXPECT_EQ(route->getLength(), 23u);
+    for(auto n : route->getNodes()) {
+        EXPECT_TRUE(graph_test1.isWalkableNode(n));
+    }
+
+    //the solid block in the middle has to be passed around
+    std::vector<Node> nodes;
+    for(auto n : graph_test1) {
+        nodes.emplace_back(n);
+    }
+
+    for(std::size_t i = 0; i < nodes.size(); i += 11) {
+        for(std::size_t j = 0; j < nodes.size(); j += 5) {
+            ASSERT_EQ(astar.findDistance(nodes[i], nodes[j]),
+                      d.findDistance(nodes[i], nodes[j]));
+        }
+    }
+}
+
+TEST(BlockAStarTest, OutdatedDatabaseTest)
+{
+    std::vector test1(24, std::vector(24, true));
+    for(std::size_t row = 0; row < 8; row++) {
+        test1[row][4] = false;
+    }
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const LocalDistanceDatabase database{graph_test1, 8};
+    BlockAStar astar{database};
+
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{0, 7}), 23);
+
+    //a gap in the wall and a new wall in the block below
+    graph_test1.setBarrier(Node{0, 4}, false);
+    for(std::size_t column = 0; column < 8; column++) {
+        graph_test1.setBarrier(Node{12, column}, true);
+    }
+
+    EXPECT_FALSE(database.isUpToDate());
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{0, 7}), 7);
+
+    DistanceGridGraphDijkstra d{graph_test1};
+
+    std::vector<Node> nodes;
+    for(auto n : graph_test1) {
+        nodes.emplace_back(n);
+    }
+
+    for(std::size_t i = 0; i < nodes.size(); i += 11) {
+        for(std::size_t j = 0; j < nodes.size(); j += 5) {
+            ASSERT_EQ(astar.findDistance(nodes[i], nodes[j]),
+                      d.findDistance(nodes[i], nodes[j]));
+
+            const auto route = astar.findRoute(nodes[i], nodes[j]);
+            if(route) {
+                for(auto n : route->getNodes()) {
+                    EXPECT_TRUE(graph_test1.isWalkableNode(n));
+                }
+            }
+        }
+    }
+}
+
+TEST(BlockAStarTest, AllSouroundingGraphTest)
+{
+    std::mt19937 gen{5};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(20, std::vector(20, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    //the blocks only use manhattan neigbours, also on 8-connected graphs
+    GridGraph graph_test1{grid, graph::AllSouroundingNeigbourCalculator{}};
+
+    const LocalDistanceDatabase database{graph_test1, 5};
+    BlockAStar block_astar{database};
+    AStar astar{graph_test1};
+
+    for(auto from : graph_test1) {
+        for(auto to : graph_test1) {
+            ASSERT_EQ(block_astar.findDistance(from, to), astar.findDistance(from, to));
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/CanonicalOctileAStar.hpp>
+#include <pathfinding/DijkstraQueue.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::Distance;
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::CanonicalOctileAStar;
+
+namespace {
+
+// cost of a single move without cutting a corner, UNREACHABLE if the move is not possible
+auto moveCost(const GridGraph& graph, Node from, Node to)
+    -> Distance
+{
+    const auto row_diff = static_cast<long>(to.row) - static_cast<long>(from.row);
+    const auto column_diff = static_cast<long>(to.column) - static_cast<long>(from.column);
+
+    if(std::abs(row_diff) > 1 or std::abs(column_diff) > 1 or !graph.isWalkableNode(to)) {
+        return graph::UNREACHABLE;
+    }
+
+    if(row_diff == 0 or column_diff == 0) {
+        return CanonicalOctileAStar::CARDINAL_COST;
+    }
+
+    if(graph.isBarrier(Node{to.row, from.column}) or graph.isBarrier(Node{from.row, to.column})) {
+        return graph::UNREACHABLE;
+    }
+
+    return CanonicalOctileAStar::DIAGONAL_COST;
+}
+
+// plain dijkstra over all eight neigbours as reference
+auto octileDijkstra(const GridGraph& graph, Node source)
+    -> std::vector<Distance>
+{
+    std::vector distances(graph.size(), graph::UNREACHABLE);
+    pathfinding::DijkstraQueue pq;
+
+    distances[graph.nodeToIndex(source)] = 0;
+    pq.emplace(source, Distance{0});
+
+    while(!pq.empty()) {
+        const auto [current, dist] = pq.top();
+        pq.pop();
+
+        if(dist > distances[graph.nodeToIndex(current)]) {
+            continue;
+        }
+
+        for(auto neig : graph::AllSouroundingNeigbourCalculator{}.calculateNeigbours(current)) {
+            const auto cost = moveCost(graph, current, neig);
+            if(cost == graph::UNREACHABLE) {
+                continue;
+            }
+
+            auto& neig_dist = distances[graph.nodeToIndex(neig)];
+            if(neig_dist > dist + cost) {
+                neig_dist = dist + cost;
+                pq.emplace(neig, neig_dist);
+            }
+        }
+    }
+
+    return distances;
+}
+
+auto checkAllPairs(const GridGraph& graph)
+    -> void
+{
+    CanonicalOctileAStar astar{graph};
+
+    for(auto from : graph) {
+        const auto expected = octileDijkstra(graph, from);
+
+        for(auto to : graph) {
+            const auto expected_dist = expected[graph.nodeToIndex(to)];
+            EXPECT_EQ(astar.findDistance(from, to), expected_dist);
+
+            const auto path = astar.findRoute(from, to);
+            ASSERT_EQ(!!path, expected_dist != graph::UNREACHABLE);
+
+            if(path) {
+                const auto& nodes = path->getNodes();
+                Distance path_dist = 0;
+                for(std::size_t i = 1; i < nodes.size(); i++) {
+                    const auto cost = moveCost(graph, nodes[i - 1], nodes[i]);
+                    ASSERT_NE(cost, graph::UNREACHABLE);
+                    path_dist += cost;
+                }
+                EXPECT_EQ(path_dist, expected_dist);
+            }
+        }
+    }
+}
+
+} // namespace
+
+
+TEST(CanonicalOctileTest, CanonicalOctileWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph(graph::AllSouroundingNeigbourCalculator{});
+
+    checkAllPairs(graph_test1);
+}
+
+TEST(CanonicalOctileTest, CanonicalOctileRandomGridTest)
+{
+    std::mt19937 gen{7};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    for(std::size_t round = 0; round < 5; round++) {
+        std::vector grid(12, std::vector(12, true));
+        for(auto& row : grid) {
+            for(std::size_t column = 0; column < row.size(); column++) {
+                row[column] = is_walkable(gen);
+            }
+        }
+
+        GridGraph graph{grid, graph::AllSouroundingNeigbourCalculator{}};
+
+        checkAllPairs(graph);
+    }
+}
+
+TEST(CanonicalOctileTest, CanonicalOctileOpenGridTest)
+{
+    std::vector open(20, std::vector(20, true));
+    GridGraph graph{open, graph::AllSouroundingNeigbourCalculator{}};
+
+    CanonicalOctileAStar astar{graph};
+
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{19, 19}),
+              19 * CanonicalOctileAStar::DIAGONAL_COST);
+
+    //only the nodes on the diagonal are expanded
+    EXPECT_EQ(astar.getNumberOfExpandedNodes(), 20);
+
+    EXPECT_EQ(astar.findDistance(Node{3, 2}, Node{5, 12}),
+              CanonicalOctileAStar::octileDistance(Node{3, 2}, Node{5, 12}));
+}
@@ -0,0 +1,63 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/CompactPath.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/Path.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::compressPath;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::Path;
+
+
+TEST(CompactPathTest, CompactPathRoundTripTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+    GridGraphDijkstra d{graph_test1};
+
+    for(auto from : graph_test1) {
+        for(auto to : graph_test1) {
+            auto path_opt = d.findRoute(from, to);
+            if(!path_opt) {
+                continue;
+            }
+
+            const auto& path = path_opt.value();
+            EXPECT_EQ(path.getSource(), from);
+            EXPECT_EQ(path.getTarget(), to);
+            EXPECT_EQ(static_cast<graph::Distance>(path.getLength()), d.findDistance(from, to));
+
+            auto compact = compressPath(path).value();
+            EXPECT_EQ(compact.getBitsPerStep(), 2);
+            EXPECT_EQ(compact.getLength(), path.getLength());
+            EXPECT_EQ(compact.toPath().getNodes(), path.getNodes());
+        }
+    }
+}
+
+TEST(CompactPathTest, CompactPathDiagonalTest)
+{
+    std::vector<Node> nodes{Node{0, 0}};
+    for(std::size_t i = 1; i < 100; i++) {
+        auto last = nodes.back();
+        nodes.emplace_back(i % 3 == 0
+                               ? Node{last.row + 1, last.column + 1}
+                               : Node{last.row, last.column + 1});
+    }
+    Path path{nodes};
+
+    auto compact = compressPath(path).value();
+    EXPECT_EQ(compact.getBitsPerStep(), 3);
+    EXPECT_EQ(compact.toPath().getNodes(), nodes);
+    EXPECT_LT(compact.byteSize(), nodes.size() * sizeof(Node) / 10);
+
+    //non neigbouring nodes can not be compressed
+    EXPECT_FALSE(compressPath(Path{std::vector{Node{0, 0}, Node{0, 2}}}));
+}
@@ -0,0 +1,191 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <fstream>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/CachingGridGraphDijkstra.hpp>
+#include <pathfinding/CompressedPathDatabase.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using pathfinding::CachingGridGraphDijkstra;
+using pathfinding::CompressedPathDatabase;
+
+namespace {
+
+auto checkPaths(const GridGraph& graph, const CompressedPathDatabase& cpd)
+    -> void
+{
+    test::forAllPairs(graph, [&](auto from, auto to, auto expected) {
+        const auto path = cpd.findRoute(from, to);
+
+        EXPECT_EQ(cpd.findDistance(from, to), expected);
+        EXPECT_EQ(!!path, expected != graph::UNREACHABLE);
+
+        if(!path) {
+            return;
+        }
+
+        EXPECT_EQ(path->getSource(), from);
+        EXPECT_EQ(path->getTarget(), to);
+        EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+    });
+}
+
+} // namespace
+
+
+TEST(CompressedPathDatabaseTest, CompressedPathDatabaseWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    CompressedPathDatabase cpd{graph_test1};
+    checkPaths(graph_test1, cpd);
+
+    CachingGridGraphDijkstra apsp{graph_test1};
+    CompressedPathDatabase apsp_cpd{apsp};
+    checkPaths(graph_test1, apsp_cpd);
+}
+
+TEST(CompressedPathDatabaseTest, CompressedPathDatabaseLongRowsTest)
+{
+    //on a single row the morton order is the column order, every row has one
+    //run to the left, the source itself and one run to the right
+    std::vector test1(1, std::vector(300, true));
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    CompressedPathDatabase cpd{graph_test1};
+    EXPECT_EQ(cpd.getNumberOfRuns(), 3u * 300u - 2u);
+    checkPaths(graph_test1, cpd);
+
+    //a wall with gaps splits the long runs of the rows
+    std::vector test2(3, std::vector(100, true));
+    for(std::size_t column = 10; column < 90; column++) {
+        test2[1][column] = column % 20 == 0;
+    }
+    GridGraph graph_test2{test2, graph::ManhattanNeigbourCalculator{}};
+
+    CachingGridGraphDijkstra apsp{graph_test2};
+    CompressedPathDatabase apsp_cpd{apsp};
+    checkPaths(graph_test2, apsp_cpd);
+}
+
+TEST(CompressedPathDatabaseTest, CompressedPathDatabaseOutdatedTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    CompressedPathDatabase cpd{graph_test1};
+
+    //old first moves would walk into the closed node or around the opened one
+    graph_test1.setBarrier({1, 2}, false);
+    graph_test1.setBarrier({4, 4}, true);
+
+    EXPECT_FALSE(cpd.isUpToDate());
+    checkPaths(graph_test1, cpd);
+}
+
+TEST(CompressedPathDatabaseTest, CompressedPathDatabaseFileTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, true, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, false}};
+
+    std::vector test2{
+        std::vector{true, true, true},
+        std::vector{true, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+    GridGraph graph_test2{test2, graph::ManhattanNeigbourCalculator{}};
+
+    CompressedPathDatabase cpd{graph_test1};
+
+    const auto file = (std::filesystem::temp_directory_path() / "cpd_test").string();
+    ASSERT_TRUE(cpd.toFile(file));
+
+    auto loaded = pathfinding::compressedPathDatabaseFromFile(graph_test1, file);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->getNumberOfRuns(), cpd.getNumberOfRuns());
+    checkPaths(graph_test1, loaded.value());
+
+    //a database can not be loaded for a graph of a different size
+    EXPECT_FALSE(pathfinding::compressedPathDatabaseFromFile(graph_test2, file));
+
+    //nor for a moved barrier, size and number of walkable nodes are the same
+    graph_test1.toggleBarrier(graph::Node{0, 2});
+    graph_test1.toggleBarrier(graph::Node{0, 3});
+    EXPECT_FALSE(pathfinding::compressedPathDatabaseFromFile(graph_test1, file));
+
+    std::filesystem::remove(file);
+}
+
+TEST(CompressedPathDatabaseTest, CompressedPathDatabaseCorruptFileTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, true, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, false}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+    const auto walkable = graph_test1.countWalkableNodes();
+
+    CompressedPathDatabase cpd{graph_test1};
+
+    const auto file = (std::filesystem::temp_directory_path() / "cpd_corrupt_test").string();
+    ASSERT_TRUE(cpd.toFile(file));
+
+    std::vector<char> bytes;
+    {
+        std::ifstream in{file, std::ios::binary};
+        bytes.assign(std::istreambuf_iterator<char>{in}, {});
+    }
+
+    //the header has four words, every vector starts with its size
+    const auto ranks_size_at = 4 * sizeof(std::uint64_t);
+    const auto offsets_at = ranks_size_at + sizeof(std::uint64_t)
+        + graph_test1.size() * sizeof(std::uint32_t)
+        + sizeof(std::uint64_t);
+    const auto starts_at = offsets_at
+        + (walkable + 1) * sizeof(std::size_t)
+        + sizeof(std::uint64_t);
+
+    const auto load = [&](auto corrupt) {
+        auto corrupted = bytes;
+        corrupt(corrupted);
+
+        std::ofstream out{file, std::ios::binary};
+        out.write(corrupted.data(), static_cast<std::streamsize>(corrupted.size()));
+        out.close();
+
+        return pathfinding::compressedPathDatabaseFromFile(graph_test1, file);
+    };
+
+    const auto write = [](auto& corrupted, std::size_t at, auto value) {
+        std::memcpy(corrupted.data() + at, &value, sizeof(value));
+    };
+
+    EXPECT_TRUE(load([](auto& /*corrupted*/) {}));
+
+    //truncated files and sizes larger than the file are rejected before
+    //anything is allocated
+    EXPECT_FALSE(load([](auto& corrupted) { corrupted.resize(corrupted.size() - 5); }));
+    EXPECT_FALSE(load([&](auto& corrupted) { write(corrupted, ranks_size_at, std::uint64_t{1} << 60); }));
+
+    //rows which are not monotonic or start outside of the runs
+    EXPECT_FALSE(load([&](auto& corrupted) { write(corrupted, offsets_at + sizeof(std::size_t), std::size_t{1} << 40); }));
+
+    //run starts outside of the rows
+    EXPECT_FALSE(load([&](auto& corrupted) { write(corrupted, starts_at + sizeof(std::uint32_t), std::uint32_t{1} << 30); }));
+
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,110 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/DeadEndPockets.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::DeadEndPockets;
+using pathfinding::GridGraphDijkstra;
+
+
+TEST(DeadEndPocketsTest, DeadEndPocketsWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    DeadEndPockets pockets{graph_test1};
+    GridGraphDijkstra pruned_dijkstra{graph_test1, pockets};
+    AStar pruned_astar{graph_test1, pockets};
+
+    EXPECT_GT(pockets.getNumberOfPockets(), 0);
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(pruned_dijkstra.findDistance(from, to), expected);
+        EXPECT_EQ(pruned_astar.findDistance(from, to), expected);
+
+        const auto path = pruned_dijkstra.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+    });
+}
+
+TEST(DeadEndPocketsTest, DeadEndPocketsSkipRoomTest)
+{
+    // a room in the lower left corner which is only connected through (3, 1)
+    std::vector test1{
+        std::vector{true, true, true, true, true, true},
+        std::vector{true, true, true, true, true, true},
+        std::vector{true, true, true, true, true, true},
+        std::vector{false, true, false, false, false, false},
+        std::vector{true, true, true, false, false, false},
+        std::vector{true, true, true, false, false, false}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    DeadEndPockets pockets{graph_test1};
+
+    const auto room_pocket = pockets.getPocket(Node{5, 0});
+    EXPECT_NE(room_pocket, DeadEndPockets::NO_POCKET);
+    EXPECT_EQ(pockets.getPocket(Node{4, 2}), room_pocket);
+    EXPECT_EQ(pockets.getPocket(Node{0, 0}), DeadEndPockets::NO_POCKET);
+    EXPECT_EQ(pockets.getPocket(Node{2, 1}), DeadEndPockets::NO_POCKET);
+
+    AStar astar{graph_test1};
+    AStar pruned_astar{graph_test1, pockets};
+
+    //the room lies between source and target, but can be skipped
+    EXPECT_EQ(pruned_astar.findDistance(Node{2, 0}, Node{2, 2}),
+              astar.findDistance(Node{2, 0}, Node{2, 2}));
+
+    EXPECT_EQ(pruned_astar.findDistance(Node{0, 0}, Node{5, 2}),
+              astar.findDistance(Node{0, 0}, Node{5, 2}));
+}
+
+TEST(DeadEndPocketsTest, DeadEndPocketsOutdatedTest)
+{
+    // a room on the left hangs off the top row, the bottom row is only
+    // reached through the corridor on the right. Opening (4, 1) turns the
+    // room into a shortcut between the top and the bottom row
+    std::vector test1{
+        std::vector{true, true, true, true, true, true, true},
+        std::vector{false, true, false, false, false, false, true},
+        std::vector{true, true, true, false, false, false, true},
+        std::vector{true, true, true, false, false, false, true},
+        std::vector{false, false, false, false, false, false, true},
+        std::vector{true, true, true, true, true, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    DeadEndPockets pockets{graph_test1};
+    GridGraphDijkstra pruned_dijkstra{graph_test1, pockets};
+    AStar pruned_astar{graph_test1, pockets};
+
+    const auto room_pocket = pockets.getPocket(Node{2, 0});
+    EXPECT_TRUE(pockets.isUpToDate());
+    EXPECT_NE(room_pocket, DeadEndPockets::NO_POCKET);
+    EXPECT_NE(pockets.getPocket(Node{0, 0}), room_pocket);
+    EXPECT_NE(pockets.getPocket(Node{5, 0}), room_pocket);
+
+    //warm the cached trees before the barrier changes
+    EXPECT_EQ(pruned_dijkstra.findDistance(Node{0, 0}, Node{5, 0}), 17);
+    EXPECT_EQ(pruned_astar.findDistance(Node{0, 0}, Node{5, 0}), 17);
+
+    graph_test1.setBarrier(Node{4, 1}, false);
+    EXPECT_FALSE(pockets.isUpToDate());
+
+    EXPECT_EQ(pruned_dijkstra.findDistance(Node{0, 0}, Node{5, 0}), 7);
+    EXPECT_EQ(pruned_astar.findDistance(Node{0, 0}, Node{5, 0}), 7);
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(pruned_dijkstra.findDistance(from, to), expected);
+        EXPECT_EQ(pruned_astar.findDistance(from, to), expected);
+    });
+}
@@ -0,0 +1,50 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/DistanceMatrix.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/HubLabelDistanceOracle.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::distanceMatrix;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::HubLabelDistanceOracle;
+
+
+TEST(DistanceMatrixTest, DistanceMatrixWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    GridGraphDijkstra d{graph_test1};
+    HubLabelDistanceOracle oracle{graph_test1};
+
+    //barriers and duplicates are allowed on both sides
+    std::vector<Node> few{Node{0, 0}, Node{0, 2}, Node{8, 11}, Node{0, 0}};
+    std::vector<Node> many;
+    for(auto n : graph_test1) {
+        many.emplace_back(n);
+    }
+    many.emplace_back(Node{3, 1});
+
+    for(const auto& [sources, targets] : {std::pair{few, many}, std::pair{many, few}, std::pair{many, many}}) {
+        std::vector<graph::Distance> results(sources.size() * targets.size());
+        std::vector<graph::Distance> oracle_results(sources.size() * targets.size());
+
+        distanceMatrix(graph_test1, sources, targets, results);
+        distanceMatrix(oracle, sources, targets, oracle_results);
+
+        for(std::size_t i = 0; i < sources.size(); i++) {
+            for(std::size_t j = 0; j < targets.size(); j++) {
+                const auto expected = d.findDistance(sources[i], targets[j]);
+                EXPECT_EQ(results[i * targets.size() + j], expected);
+                EXPECT_EQ(oracle_results[i * targets.size() + j], expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,232 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/HierarchicalAStar.hpp>
+#include <pathfinding/HierarchicalGraph.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DistanceAStar;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::HierarchicalAStar;
+using pathfinding::HierarchicalGraph;
+
+namespace {
+
+auto checkRoutes(const GridGraph& graph, HierarchicalAStar& astar, std::size_t step)
+    -> void
+{
+    DistanceGridGraphDijkstra d{graph};
+
+    std::vector<Node> nodes;
+    for(auto n : graph) {
+        nodes.emplace_back(n);
+    }
+
+    for(std::size_t i = 0; i < nodes.size(); i += step) {
+        for(std::size_t j = 0; j < nodes.size(); j += 7) {
+            const auto source = nodes[i];
+            const auto target = nodes[j];
+            const auto expected = d.findDistance(source, target);
+
+            ASSERT_EQ(astar.findDistance(source, target), expected);
+
+            const auto route = astar.findRoute(source, target);
+            if(expected == graph::UNREACHABLE) {
+                EXPECT_FALSE(route);
+                continue;
+            }
+
+            ASSERT_TRUE(route);
+            EXPECT_EQ(static_cast<graph::Distance>(route->getLength()), expected);
+            EXPECT_EQ(route->getSource(), source);
+            EXPECT_EQ(route->getTarget(), target);
+
+            const auto& path = route->getNodes();
+            for(std::size_t k = 1; k < path.size(); k++) {
+                EXPECT_TRUE(graph.areNeighbours(path[k - 1], path[k]));
+                EXPECT_FALSE(graph.isBarrier(path[k]));
+            }
+        }
+    }
+}
+
+} // namespace
+
+
+TEST(HierarchicalAStarTest, AbstractionTest)
+{
+    std::vector test1(20, std::vector(30, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    //the root cell has 32 nodes per side, the kept levels have cells with
+    //16, 8 and 4 nodes per side
+    const HierarchicalGraph hierarchy{graph_test1, 4, 3};
+    EXPECT_EQ(hierarchy.getNumberOfLevels(), 3u);
+    EXPECT_EQ(hierarchy.getNumberOfCells(0), 2u * 2u);
+    EXPECT_EQ(hierarchy.getNumberOfCells(2), 5u * 8u);
+
+    //a free inner leaf has all nodes of its border as entrances
+    const auto leaf = hierarchy.getCellId(2, Node{5, 5});
+    EXPECT_EQ(hierarchy.getEntrances(2, leaf).size(), 12u);
+    EXPECT_EQ(hierarchy.getCell(2, leaf)[0], (Node{4, 4}));
+
+    const auto top_left = hierarchy.getEntranceIndex(2, Node{4, 4});
+    const auto bottom_right = hierarchy.getEntranceIndex(2, Node{7, 7});
+    ASSERT_NE(top_left, HierarchicalGraph::NO_ENTRANCE);
+    ASSERT_NE(bottom_right, HierarchicalGraph::NO_ENTRANCE);
+    EXPECT_EQ(hierarchy.getCellDistance(2, leaf, top_left, bottom_right), 6);
+    EXPECT_EQ(hierarchy.getEntranceIndex(2, Node{5, 5}), HierarchicalGraph::NO_ENTRANCE);
+
+    //nodes at the border of the grid have no neigbour in another cell
+    EXPECT_EQ(hierarchy.getEntranceIndex(2, Node{0, 1}), HierarchicalGraph::NO_ENTRANCE);
+}
+
+TEST(HierarchicalAStarTest, RandomGridTest)
+{
+    std::mt19937 gen{17};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    std::vector grid(41, std::vector(53, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    for(auto [leaf_size, levels] : {std::pair{2, 1}, std::pair{4, 2}, std::pair{8, 3}, std::pair{4, 10}}) {
+        const HierarchicalGraph hierarchy{graph, static_cast<std::size_t>(leaf_size), static_cast<std::size_t>(levels)};
+        HierarchicalAStar astar{hierarchy};
+
+        checkRoutes(graph, astar, 31);
+    }
+}
+
+TEST(HierarchicalAStarTest, MultiLevelRoomsTest)
+{
+    //rooms of 16x16 nodes with doors at different positions, so paths
+    //cross coarse cells whose inner distances are not the manhattan distance
+    std::vector grid(64, std::vector(64, true));
+    for(std::size_t i = 0; i < 64; i++) {
+        for(std::size_t wall : {15, 31, 47}) {
+            grid[wall][i] = i % 16 == (wall * 7) % 16;
+            grid[i][wall] = i % 16 == (wall * 3) % 16;
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    //cells with 32, 16, 8 and 4 nodes per side
+    const HierarchicalGraph hierarchy{graph, 4, 4};
+    ASSERT_EQ(hierarchy.getNumberOfLevels(), 4u);
+    EXPECT_EQ(hierarchy.getNumberOfCells(0), 2u * 2u);
+    EXPECT_EQ(hierarchy.getNumberOfCells(3), 16u * 16u);
+
+    HierarchicalAStar astar{hierarchy};
+    checkRoutes(graph, astar, 97);
+
+    //the long query crosses coarse cells with single edges
+    DistanceAStar grid_astar{graph};
+    const Node from{0, 0};
+    const Node to{63, 63};
+    EXPECT_EQ(astar.findDistance(from, to), grid_astar.findDistance(from, to));
+    EXPECT_LT(astar.getNumberOfExpandedNodes(), grid_astar.getNumberOfExpandedNodes());
+}
+
+TEST(HierarchicalAStarTest, AllSouroundingGraphTest)
+{
+    std::mt19937 gen{11};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(20, std::vector(20, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    //the hierarchy only uses manhattan neigbours, also on 8-connected graphs
+    GridGraph graph{grid, graph::AllSouroundingNeigbourCalculator{}};
+
+    const HierarchicalGraph hierarchy{graph, 2, 3};
+    HierarchicalAStar astar{hierarchy};
+    DistanceAStar grid_astar{graph};
+
+    for(auto from : graph) {
+        for(auto to : graph) {
+            ASSERT_EQ(astar.findDistance(from, to), grid_astar.findDistance(from, to));
+        }
+    }
+}
+
+TEST(HierarchicalAStarTest, UpdateTest)
+{
+    std::mt19937 gen{19};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(32, std::vector(32, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    HierarchicalGraph hierarchy{graph, 4, 3};
+    HierarchicalAStar astar{hierarchy};
+
+    //toggle barriers at cell borders and inside of cells
+    for(auto n : {Node{3, 3}, Node{4, 4}, Node{7, 8}, Node{15, 16}, Node{16, 15}, Node{20, 21}}) {
+        graph.toggleBarrier(n);
+        hierarchy.update(n);
+        EXPECT_TRUE(hierarchy.isUpToDate());
+
+        checkRoutes(graph, astar, 37);
+    }
+
+    //a change the hierarchy missed is detected, queries fall back to the grid
+    graph.toggleBarrier(Node{12, 12});
+    EXPECT_FALSE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 41);
+
+    hierarchy.update(Node{12, 12});
+    EXPECT_TRUE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 43);
+
+    //two changes and only one of them reported
+    graph.toggleBarrier(Node{9, 10});
+    graph.toggleBarrier(Node{24, 23});
+    hierarchy.update(Node{9, 10});
+    EXPECT_FALSE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 47);
+
+    hierarchy.update(Node{24, 23});
+    EXPECT_TRUE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 53);
+
+    //a node which did not change is reported instead of the changed one
+    graph.toggleBarrier(Node{5, 6});
+    hierarchy.update(Node{27, 2});
+    EXPECT_FALSE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 59);
+
+    hierarchy.update(Node{5, 6});
+    EXPECT_TRUE(hierarchy.isUpToDate());
+
+    //a node which changed twice only needs to be reported once
+    graph.toggleBarrier(Node{30, 30});
+    graph.toggleBarrier(Node{30, 30});
+    hierarchy.update(Node{30, 30});
+    EXPECT_TRUE(hierarchy.isUpToDate());
+    checkRoutes(graph, astar, 61);
+}
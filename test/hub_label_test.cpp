@@ -0,0 +1,63 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/HubLabelDistanceOracle.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using pathfinding::HubLabelDistanceOracle;
+
+
+TEST(HubLabelTest, HubLabelWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    HubLabelDistanceOracle oracle{graph_test1};
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(oracle.findDistance(from, to), expected);
+    });
+
+    EXPECT_GT(oracle.getIndexSize(), 0);
+}
+
+TEST(HubLabelTest, HubLabelUnreachableTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    HubLabelDistanceOracle oracle{graph_test1};
+
+    EXPECT_EQ(oracle.findDistance({0, 0}, {4, 1}), 5);
+    EXPECT_EQ(oracle.findDistance({0, 0}, {0, 3}), graph::UNREACHABLE);
+    EXPECT_EQ(oracle.findDistance({0, 0}, {0, 2}), graph::UNREACHABLE);
+    EXPECT_EQ(oracle.findDistance({4, 4}, {4, 4}), 0);
+}
+
+TEST(HubLabelTest, HubLabelOutdatedTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    HubLabelDistanceOracle oracle{graph_test1};
+
+    //opens a shortcut through the wall and closes the open area on the right
+    graph_test1.setBarrier({1, 2}, false);
+    graph_test1.setBarrier({4, 10}, true);
+    graph_test1.setBarrier({4, 11}, true);
+
+    EXPECT_FALSE(oracle.isUpToDate());
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(oracle.findDistance(from, to), expected);
+    });
+}
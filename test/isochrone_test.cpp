@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/Isochrone.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::findIsochrone;
+
+
+TEST(IsochroneTest, RandomGridTest)
+{
+    std::mt19937 gen{5};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(30, std::vector(40, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    DistanceGridGraphDijkstra d{graph};
+
+    std::vector<Node> centers;
+    for(auto n : graph) {
+        centers.emplace_back(n);
+    }
+
+    for(std::size_t i = 0; i < centers.size(); i += 17) {
+        const auto center = centers[i];
+
+        for(graph::Distance radius : {0, 1, 3, 8, 20, 100}) {
+            const auto isochrone = findIsochrone(graph, center, radius);
+
+            std::vector<std::size_t> expected;
+            for(auto n : graph) {
+                const auto distance = d.findDistance(center, n);
+                const auto is_inside = distance != graph::UNREACHABLE and distance <= radius;
+
+                EXPECT_EQ(isochrone.contains(n), is_inside);
+                if(is_inside) {
+                    expected.emplace_back(graph.nodeToIndex(n));
+                }
+            }
+
+            std::sort(std::begin(expected),
+                      std::end(expected));
+
+            EXPECT_EQ(isochrone.size(), expected.size());
+            EXPECT_EQ(isochrone.toIndices(graph), expected);
+
+            //the bitmap covers at most the bounding box of the radius
+            EXPECT_LE(isochrone.getHeight(), static_cast<std::size_t>(2 * radius + 1));
+            EXPECT_LE(isochrone.getWidth(), static_cast<std::size_t>(2 * radius + 1));
+        }
+    }
+}
+
+TEST(IsochroneTest, BoundaryTest)
+{
+    std::vector test1(10, std::vector(10, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const auto corner = findIsochrone(graph_test1, Node{0, 0}, 2);
+    EXPECT_EQ(corner.size(), 6u);
+    EXPECT_EQ(corner.getTopLeft(), (Node{0, 0}));
+    EXPECT_EQ(corner.getHeight(), 3u);
+    EXPECT_EQ(corner.getWidth(), 3u);
+    EXPECT_TRUE(corner.contains(Node{1, 1}));
+    EXPECT_FALSE(corner.contains(Node{2, 2}));
+    EXPECT_FALSE(corner.contains(Node{9, 9}));
+
+    const auto everything = findIsochrone(graph_test1, Node{5, 5}, graph::UNREACHABLE);
+    EXPECT_EQ(everything.size(), graph_test1.size());
+
+    graph_test1.setBarrier(Node{5, 5}, true);
+    EXPECT_TRUE(findIsochrone(graph_test1, Node{5, 5}, 3).empty());
+    EXPECT_TRUE(findIsochrone(graph_test1, Node{0, 0}, -1).empty());
+}
@@ -0,0 +1,73 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/Heuristic.hpp>
+#include <pathfinding/Landmarks.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using pathfinding::AStar;
+using pathfinding::LandmarkHeuristic;
+using pathfinding::Landmarks;
+using pathfinding::LandmarkStrategy;
+
+
+TEST(LandmarkTest, LandmarkAStarWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    for(auto strategy : {LandmarkStrategy::FARTHEST, LandmarkStrategy::AVOID}) {
+        Landmarks landmarks{graph_test1, 4, strategy};
+        AStar alt{graph_test1, LandmarkHeuristic{landmarks}};
+
+        EXPECT_EQ(landmarks.getLandmarks().size(), 4);
+
+        test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+            EXPECT_LE(landmarks.getLowerBound(from, to), expected);
+            EXPECT_EQ(alt.findDistance(from, to), expected);
+        });
+    }
+}
+
+TEST(LandmarkTest, LandmarkOutdatedTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    Landmarks landmarks{graph_test1, 4};
+    AStar alt{graph_test1, LandmarkHeuristic{landmarks}};
+
+    //the shortcut through the wall makes some of the old bounds too large
+    graph_test1.setBarrier({1, 2}, false);
+    graph_test1.setBarrier({5, 4}, false);
+
+    EXPECT_FALSE(landmarks.isUpToDate());
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_LE(landmarks.getLowerBound(from, to), expected);
+        EXPECT_EQ(alt.findDistance(from, to), expected);
+    });
+}
+
+TEST(LandmarkTest, LandmarkExpandsLessNodesTest)
+{
+    std::vector test1{
+        std::vector{true, true, true, true, true, true, true},
+        std::vector{true, false, false, false, false, false, true},
+        std::vector{true, true, true, true, true, false, true},
+        std::vector{false, false, false, false, true, false, true},
+        std::vector{true, true, true, true, true, false, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    Landmarks landmarks{graph_test1, 2};
+    AStar manhattan{graph_test1};
+    AStar alt{graph_test1, LandmarkHeuristic{landmarks}};
+
+    EXPECT_EQ(manhattan.findDistance({4, 0}, {4, 6}), alt.findDistance({4, 0}, {4, 6}));
+    EXPECT_LE(alt.getNumberOfExpandedNodes(), manhattan.getNumberOfExpandedNodes());
+}
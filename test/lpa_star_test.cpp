@@ -0,0 +1,155 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/LPAStar.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::LPAStar;
+
+
+TEST(LPAStarTest, LPAStarWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    LPAStar lpa{graph_test1};
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(lpa.findDistance(from, to), expected);
+
+        const auto path = lpa.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+        }
+    });
+}
+
+TEST(LPAStarTest, LPAStarReplanningTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const Node from{0, 0};
+    const Node to{19, 19};
+
+    LPAStar lpa{graph_test1};
+    GridGraphDijkstra d{graph_test1};
+
+    EXPECT_EQ(lpa.findDistance(from, to), 38);
+    const auto initial_expansions = lpa.getNumberOfExpandedNodes();
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> dis(0, 19);
+
+    for(std::size_t round = 0; round < 200; round++) {
+        std::vector<Node> changed;
+        for(std::size_t i = 0; i < 5; i++) {
+            const Node node{dis(gen), dis(gen)};
+            if(node != from and node != to) {
+                graph_test1.toggleBarrier(node);
+                changed.emplace_back(node);
+            }
+        }
+
+        lpa.updateNodes(changed);
+
+        const auto expected = d.findDistance(from, to);
+        EXPECT_EQ(lpa.findDistance(from, to), expected);
+
+        const auto path = lpa.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            for(auto node : path->getNodes()) {
+                EXPECT_TRUE(graph_test1.isWalkableNode(node));
+            }
+        }
+    }
+
+    //a single new barrier only needs a local repair
+    const Node blocked{10, 10};
+    graph_test1.setBarrier(blocked, false);
+    [[maybe_unused]] auto _ = lpa.findDistance(from, to);
+    graph_test1.setBarrier(blocked, true);
+    lpa.updateNodes({blocked});
+    EXPECT_EQ(lpa.findDistance(from, to), d.findDistance(from, to));
+    EXPECT_LT(lpa.getNumberOfExpandedNodes(), initial_expansions);
+}
+
+TEST(LPAStarTest, LPAStarUnreportedChangeTest)
+{
+    std::vector test1(10, std::vector(10, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const Node from{0, 0};
+    const Node to{9, 0};
+
+    LPAStar lpa{graph_test1};
+    GridGraphDijkstra d{graph_test1};
+
+    EXPECT_EQ(lpa.findDistance(from, to), 9);
+
+    //a wall with a gap on the right, none of it is reported
+    for(std::size_t column = 0; column < 9; column++) {
+        graph_test1.setBarrier(Node{5, column}, true);
+    }
+
+    EXPECT_EQ(lpa.findDistance(from, to), d.findDistance(from, to));
+
+    //only one of two changes is reported
+    graph_test1.setBarrier(Node{5, 0}, false);
+    graph_test1.setBarrier(Node{5, 9}, true);
+    lpa.updateNodes({Node{5, 9}});
+
+    EXPECT_EQ(lpa.findDistance(from, to), 9);
+
+    const auto path = lpa.findRoute(from, to);
+    ASSERT_TRUE(path);
+    for(auto node : path->getNodes()) {
+        EXPECT_TRUE(graph_test1.isWalkableNode(node));
+    }
+
+    //the gap is closed, but a node which did not change is reported instead
+    graph_test1.setBarrier(Node{5, 0}, true);
+    lpa.updateNodes({Node{0, 5}});
+
+    EXPECT_EQ(lpa.findDistance(from, to), graph::UNREACHABLE);
+}
+
+TEST(LPAStarTest, GridGraphBarrierUpdateTest)
+{
+    std::vector test1(3, std::vector(3, true));
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const auto version = graph_test1.getVersion();
+
+    EXPECT_TRUE(graph_test1.setBarrier(Node{1, 1}, true));
+    EXPECT_TRUE(graph_test1.isBarrier(Node{1, 1}));
+    EXPECT_NE(graph_test1.getVersion(), version);
+
+    EXPECT_TRUE(graph_test1.toggleBarrier(Node{1, 1}));
+    EXPECT_TRUE(graph_test1.isWalkableNode(Node{1, 1}));
+
+    //setting the current state again is no change
+    EXPECT_TRUE(graph_test1.setBarrier(Node{0, 1}, false));
+    EXPECT_EQ(graph_test1.getVersion(), version + 2);
+
+    const auto changed = graph_test1.getChangedNodesSince(version);
+    ASSERT_EQ(changed.size(), 2u);
+    EXPECT_EQ(changed[0], (Node{1, 1}));
+    EXPECT_EQ(changed[1], (Node{1, 1}));
+    EXPECT_TRUE(graph_test1.getChangedNodesSince(version + 2).empty());
+
+    EXPECT_FALSE(graph_test1.setBarrier(Node{3, 0}, true));
+}
@@ -2,11 +2,14 @@
 #include <fmt/ostream.h>
 #include <fmt/ranges.h>
 #include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
 #include <pathfinding/GridGraphDijkstra.hpp>
 
 #include <gtest/gtest.h>
 
 using graph::GridGraph;
+using pathfinding::DistanceAStar;
+using pathfinding::DistanceGridGraphDijkstra;
 using pathfinding::GridGraphDijkstra;
 
 
@@ -119,3 +122,27 @@ TEST(ManhattanDijkstraTest, DijkstraWithBarrierDistanceTest)
     dist = d.findDistance({0, 4}, {0, 0});
     EXPECT_EQ(dist, 6);
 }
+
+TEST(ManhattanDijkstraTest, DistanceOnlyDijkstraTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, true, true, true},
+        std::vector{true, false, false, false, true},
+        std::vector{true, true, false, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    GridGraphDijkstra d{graph_test1};
+    DistanceGridGraphDijkstra distance_only{graph_test1};
+    DistanceAStar distance_only_astar{graph_test1};
+
+    for(auto from : graph_test1) {
+        for(auto to : graph_test1) {
+            const auto expected = d.findDistance(from, to);
+            EXPECT_EQ(distance_only.findDistance(from, to), expected);
+            EXPECT_EQ(distance_only_astar.findDistance(from, to), expected);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/MovingRootTree.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::MovingRootTree;
+
+
+TEST(MovingRootTreeTest, RandomWalkTest)
+{
+    std::mt19937 gen{11};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    std::vector grid(25, std::vector(25, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+    grid[12][12] = true;
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    MovingRootTree tree{graph};
+    DistanceGridGraphDijkstra d{graph};
+
+    Node root{12, 12};
+    for(std::size_t step = 0; step < 200; step++) {
+        for(auto target : graph) {
+            ASSERT_EQ(tree.findDistance(root, target), d.findDistance(root, target));
+        }
+
+        //walk to a random walkable neigbour
+        std::vector<Node> neigbours;
+        for(auto neig : graph.getManhattanNeigbours(root)) {
+            if(!graph.isBarrier(neig)) {
+                neigbours.emplace_back(neig);
+            }
+        }
+        if(neigbours.empty()) {
+            break;
+        }
+
+        std::uniform_int_distribution<std::size_t> pick{0, neigbours.size() - 1};
+        root = neigbours[pick(gen)];
+    }
+
+    //the walk rarely drifts far enough from the anchor to rebuild the tree
+    EXPECT_LT(tree.getNumberOfRebuilds(), 10u);
+}
+
+TEST(MovingRootTreeTest, OpenGridWalkTest)
+{
+    std::vector test1(200, std::vector(200, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    constexpr std::size_t max_drift = 32;
+    MovingRootTree tree{graph_test1, max_drift};
+
+    //every move changes the distance of every node, a move still only
+    //searches around the path to the target
+    const Node target{199, 199};
+    for(std::size_t step = 0; step < 150; step++) {
+        const Node root{(step + 1) / 2, step / 2};
+        EXPECT_EQ(tree.findDistance(root, target), static_cast<graph::Distance>(398 - step));
+        EXPECT_LT(tree.getNumberOfExpandedNodes(), graph_test1.size() / 20);
+    }
+
+    //each rebuild is shared by the moves within the drift of its anchor
+    EXPECT_LE(tree.getNumberOfRebuilds(), 150 / max_drift + 1);
+}
+
+TEST(MovingRootTreeTest, AnchorTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    //a wall with a single gap
+    for(std::size_t row = 0; row < 19; row++) {
+        graph_test1.setBarrier(Node{row, 10}, true);
+    }
+
+    MovingRootTree tree{graph_test1, 16};
+    DistanceGridGraphDijkstra d{graph_test1};
+
+    //queries from the anchor are answered by the tree, queries from close
+    //nodes are guided by it through the gap
+    EXPECT_EQ(tree.findDistance(Node{19, 9}, Node{0, 19}), 29);
+    EXPECT_EQ(tree.getNumberOfExpandedNodes(), 0u);
+    EXPECT_EQ(tree.findDistance(Node{18, 9}, Node{0, 19}), 30);
+    EXPECT_LT(tree.getNumberOfExpandedNodes(), graph_test1.size() / 4);
+    EXPECT_EQ(tree.getNumberOfRebuilds(), 1u);
+
+    const auto route = tree.findRoute(Node{18, 9}, Node{0, 19});
+    ASSERT_TRUE(route);
+    EXPECT_EQ(route->getSource(), (Node{18, 9}));
+    EXPECT_EQ(route->getTarget(), (Node{0, 19}));
+    EXPECT_EQ(route->getLength(), 30u);
+
+    const auto& nodes = route->getNodes();
+    for(std::size_t i = 1; i < nodes.size(); i++) {
+        EXPECT_TRUE(graph_test1.areNeighbours(nodes[i - 1], nodes[i]));
+    }
+
+    const auto anchor_route = tree.findRoute(Node{19, 9}, Node{0, 19});
+    ASSERT_TRUE(anchor_route);
+    EXPECT_EQ(anchor_route->getSource(), (Node{19, 9}));
+    EXPECT_EQ(anchor_route->getLength(), 29u);
+
+    //jumps beyond the drift and barrier changes rebuild the tree
+    EXPECT_EQ(tree.findDistance(Node{0, 0}, Node{0, 19}), d.findDistance(Node{0, 0}, Node{0, 19}));
+    EXPECT_EQ(tree.getNumberOfRebuilds(), 2u);
+
+    graph_test1.setBarrier(Node{19, 10}, true);
+    EXPECT_EQ(tree.findDistance(Node{0, 0}, Node{0, 19}), graph::UNREACHABLE);
+    EXPECT_EQ(tree.getNumberOfRebuilds(), 3u);
+    EXPECT_FALSE(tree.findRoute(Node{0, 0}, Node{0, 19}));
+
+    EXPECT_EQ(tree.findDistance(Node{0, 10}, Node{0, 0}), graph::UNREACHABLE);
+}
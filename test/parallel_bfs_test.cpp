@@ -0,0 +1,100 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/CachingGridGraphDijkstra.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/ParallelBfs.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::CachingGridGraphDijkstra;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::ParallelBfs;
+
+
+TEST(ParallelBfsTest, ParallelBfsWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    DistanceGridGraphDijkstra d{graph_test1};
+    ParallelBfs single_thread{graph_test1, 1};
+    ParallelBfs bfs{graph_test1, 4};
+
+    for(auto from : graph_test1) {
+        const auto distances = bfs.findAllDistances(from);
+        const auto single_thread_distances = single_thread.findAllDistances(from);
+
+        for(auto to : graph_test1) {
+            const auto expected = d.findDistance(from, to);
+            EXPECT_EQ(distances[graph_test1.nodeToIndex(to)], expected);
+            EXPECT_EQ(single_thread_distances[graph_test1.nodeToIndex(to)], expected);
+            EXPECT_EQ(bfs.findDistance(from, to), expected);
+        }
+    }
+
+    const auto from_barrier = bfs.findAllDistances(Node{0, 2});
+    for(auto dist : from_barrier) {
+        EXPECT_EQ(dist, graph::UNREACHABLE);
+    }
+}
+
+TEST(ParallelBfsTest, ParallelBfsLargeGridTest)
+{
+    std::mt19937 gen{3};
+    std::bernoulli_distribution is_walkable{0.8};
+
+    std::vector grid(300, std::vector(300, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+    grid[150][150] = true;
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    DistanceGridGraphDijkstra d{graph};
+    ParallelBfs bfs{graph};
+
+    const Node source{150, 150};
+    const auto distances = bfs.findAllDistances(source);
+
+    for(auto to : graph) {
+        EXPECT_EQ(distances[graph.nodeToIndex(to)], d.findDistance(source, to));
+    }
+}
+
+TEST(ParallelBfsTest, ParallelBfsAllSouroundingNeigboursTest)
+{
+    std::vector grid(20, std::vector(30, true));
+    GridGraph graph{grid, graph::AllSouroundingNeigbourCalculator{}};
+
+    ParallelBfs bfs{graph, 4};
+
+    const Node source{7, 12};
+    const auto distances = bfs.findAllDistances(source);
+
+    for(auto to : graph) {
+        const auto row_dist = std::max(to.row, source.row) - std::min(to.row, source.row);
+        const auto column_dist = std::max(to.column, source.column) - std::min(to.column, source.column);
+        const auto expected = static_cast<graph::Distance>(std::max(row_dist, column_dist));
+        EXPECT_EQ(distances[graph.nodeToIndex(to)], expected);
+    }
+}
+
+TEST(ParallelBfsTest, CachingDijkstraRowsTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    CachingGridGraphDijkstra apsp{graph_test1};
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(apsp.findDistance(from, to), expected);
+    });
+}
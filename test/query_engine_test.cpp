@@ -0,0 +1,47 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/QueryEngine.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using pathfinding::AStar;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::QueryEngine;
+
+
+TEST(QueryEngineTest, QueryEngineWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    std::vector<QueryEngine<AStar>::Query> queries;
+    for(auto from : graph_test1) {
+        for(auto to : graph_test1) {
+            queries.emplace_back(to, from);
+        }
+    }
+
+    QueryEngine<GridGraphDijkstra> dijkstra_engine{graph_test1};
+    QueryEngine<AStar> astar_engine{graph_test1};
+    GridGraphDijkstra d{graph_test1};
+
+    const auto dijkstra_results = dijkstra_engine.findDistances(queries);
+
+    std::vector<graph::Distance> astar_results(queries.size());
+    astar_engine.findDistances(queries, astar_results);
+
+    ASSERT_EQ(dijkstra_results.size(), queries.size());
+
+    for(std::size_t i{0}; i < queries.size(); i++) {
+        auto [from, to] = queries[i];
+        auto expected = d.findDistance(from, to);
+        EXPECT_EQ(dijkstra_results[i], expected);
+        EXPECT_EQ(astar_results[i], expected);
+    }
+}
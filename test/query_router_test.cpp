@@ -0,0 +1,120 @@
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/QueryRouter.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DistanceAStar;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::QueryRoute;
+using pathfinding::QueryRouter;
+using pathfinding::QueryShortcuts;
+
+
+TEST(QueryRouterTest, ShortcutTest)
+{
+    std::vector test1{
+        std::vector{true, true, true, true},
+        std::vector{true, false, true, false},
+        std::vector{true, true, true, false},
+        std::vector{false, false, false, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+    QueryShortcuts shortcuts{graph_test1};
+
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{0, 1}), QueryRoute::NEIGBOURS);
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{0, 3}), QueryRoute::FREE_RECTANGLE);
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{2, 2}), QueryRoute::FALLBACK);
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{3, 3}), QueryRoute::UNREACHABLE);
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{1, 1}), QueryRoute::UNREACHABLE);
+    EXPECT_EQ(shortcuts.getComponent(Node{1, 1}), QueryShortcuts::NO_COMPONENT);
+    EXPECT_EQ(shortcuts.getComponent(Node{0, 0}), shortcuts.getComponent(Node{2, 2}));
+
+    //the shortcuts are recomputed after the graph changed
+    graph_test1.toggleBarrier(Node{3, 2});
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 0}, Node{3, 3}), QueryRoute::FALLBACK);
+    EXPECT_EQ(shortcuts.findRoute(Node{0, 2}, Node{3, 2}), QueryRoute::FREE_RECTANGLE);
+}
+
+TEST(QueryRouterTest, RandomGridTest)
+{
+    std::mt19937 gen{23};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(37, std::vector(43, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+    DistanceGridGraphDijkstra d{graph};
+    QueryRouter<DistanceAStar> router{graph, graph};
+
+    std::uniform_int_distribution<std::size_t> row_dist{0, graph.getHeight() - 1};
+    std::uniform_int_distribution<std::size_t> column_dist{0, graph.getWidth() - 1};
+
+    for(int i = 0; i < 3000; i++) {
+        //small offsets make neigbours and free rectangles more likely
+        const Node source{row_dist(gen), column_dist(gen)};
+        const auto target = i % 2 == 0
+            ? Node{row_dist(gen), column_dist(gen)}
+            : Node{std::min(source.row + i % 3, graph.getHeight() - 1),
+                   std::min(source.column + i % 5 / 2, graph.getWidth() - 1)};
+
+        ASSERT_EQ(router.findDistance(source, target), d.findDistance(source, target));
+
+        //barriers change from time to time
+        if(i % 500 == 499) {
+            graph.toggleBarrier(Node{row_dist(gen), column_dist(gen)});
+        }
+    }
+
+    for(auto route : {QueryRoute::UNREACHABLE,
+                      QueryRoute::NEIGBOURS,
+                      QueryRoute::FREE_RECTANGLE,
+                      QueryRoute::FALLBACK}) {
+        EXPECT_GT(router.getStatistics(route).number_of_queries, 0u);
+    }
+
+    router.resetStatistics();
+    EXPECT_EQ(router.getStatistics(QueryRoute::FALLBACK).number_of_queries, 0u);
+}
+
+TEST(QueryRouterTest, AllSouroundingGraphTest)
+{
+    std::mt19937 gen{29};
+    std::bernoulli_distribution is_walkable{0.75};
+
+    std::vector grid(17, std::vector(19, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    //the shortcuts ignore the diagonal neigbours of the graph
+    GridGraph graph{grid, graph::AllSouroundingNeigbourCalculator{}};
+    QueryRouter<DistanceAStar> router{graph, graph};
+    DistanceAStar astar{graph};
+
+    for(auto source : graph) {
+        for(auto target : graph) {
+            ASSERT_EQ(router.findDistance(source, target), astar.findDistance(source, target));
+        }
+    }
+
+    grid = std::vector(3, std::vector(3, true));
+    grid[0][1] = false;
+    grid[1][0] = false;
+    GridGraph diagonal_graph{grid, graph::AllSouroundingNeigbourCalculator{}};
+    QueryShortcuts diagonal_shortcuts{diagonal_graph};
+
+    EXPECT_EQ(diagonal_shortcuts.findRoute(Node{0, 0}, Node{1, 1}), QueryRoute::UNREACHABLE);
+    EXPECT_EQ(diagonal_shortcuts.findRoute(Node{1, 1}, Node{2, 2}), QueryRoute::FREE_RECTANGLE);
+}
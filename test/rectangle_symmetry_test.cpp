@@ -0,0 +1,183 @@
+#include <filesystem>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/RectangleDecomposition.hpp>
+#include <pathfinding/SymmetryReducedAStar.hpp>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::RectangleDecomposition;
+using pathfinding::SymmetryReducedAStar;
+
+
+TEST(RectangleSymmetryTest, SymmetryReducedAStarWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    RectangleDecomposition rectangles{graph_test1};
+    SymmetryReducedAStar rsr{graph_test1, rectangles};
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(rsr.findDistance(from, to), expected);
+
+        const auto path = rsr.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            EXPECT_EQ(path->getSource(), from);
+            EXPECT_EQ(path->getTarget(), to);
+            for(auto node : path->getNodes()) {
+                EXPECT_TRUE(graph_test1.isWalkableNode(node));
+            }
+        }
+    });
+}
+
+TEST(RectangleSymmetryTest, SymmetryReducedAStarOutdatedTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    RectangleDecomposition rectangles{graph_test1};
+    SymmetryReducedAStar rsr{graph_test1, rectangles};
+
+    //a barrier inside of the open area and a node which is in no rectangle
+    graph_test1.setBarrier({7, 8}, true);
+    graph_test1.setBarrier({1, 2}, false);
+
+    EXPECT_FALSE(rectangles.isUpToDate());
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(rsr.findDistance(from, to), expected);
+
+        const auto path = rsr.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            for(auto node : path->getNodes()) {
+                EXPECT_TRUE(graph_test1.isWalkableNode(node));
+            }
+        }
+    });
+}
+
+TEST(RectangleSymmetryTest, SymmetryReducedAStarOpenGridTest)
+{
+    std::vector open(20, std::vector(20, true));
+    open[10][10] = false;
+
+    GridGraph graph{open, graph::ManhattanNeigbourCalculator{}};
+
+    RectangleDecomposition rectangles{graph};
+    SymmetryReducedAStar rsr{graph, rectangles};
+    AStar astar{graph};
+
+    EXPECT_LT(rectangles.countPerimeterNodes(), graph.countWalkableNodes());
+
+    const Node from{2, 3};
+    const Node to{17, 18};
+
+    EXPECT_EQ(rsr.findDistance(from, to), astar.findDistance(from, to));
+    EXPECT_LT(rsr.getNumberOfExpandedNodes(), astar.getNumberOfExpandedNodes());
+}
+
+TEST(RectangleSymmetryTest, SymmetryReducedAStarRoomsTest)
+{
+    //rooms separated by walls with doors, so paths cross the interiors of
+    //several rectangles one after another
+    std::vector rooms(24, std::vector(30, true));
+    for(std::size_t row = 0; row < 24; row++) {
+        rooms[row][12] = row == 4 or row == 20;
+        rooms[row][21] = row == 15;
+    }
+    for(std::size_t column = 0; column < 12; column++) {
+        rooms[11][column] = column == 6;
+    }
+    rooms[5][5] = false;
+    rooms[17][25] = false;
+
+    GridGraph graph{rooms, graph::ManhattanNeigbourCalculator{}};
+
+    RectangleDecomposition rectangles{graph};
+    SymmetryReducedAStar rsr{graph, rectangles};
+    DistanceGridGraphDijkstra d{graph};
+
+    std::set<RectangleDecomposition::RectangleId> with_interior;
+    for(auto node : graph) {
+        const auto& rectangle = rectangles.getRectangleOf(node);
+        if(rectangle.getWidth() > 2 and rectangle.getHeight() > 2) {
+            with_interior.insert(rectangles.getRectangleIdOf(node));
+        }
+    }
+    EXPECT_GE(with_interior.size(), 3u);
+
+    std::vector<Node> nodes;
+    for(auto node : graph) {
+        nodes.emplace_back(node);
+    }
+
+    for(std::size_t i = 0; i < nodes.size(); i += 13) {
+        for(std::size_t j = 0; j < nodes.size(); j += 3) {
+            const auto from = nodes[i];
+            const auto to = nodes[j];
+            const auto expected = d.findDistance(from, to);
+
+            ASSERT_EQ(rsr.findDistance(from, to), expected);
+
+            const auto path = rsr.findRoute(from, to);
+            ASSERT_TRUE(path);
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+
+            const auto& path_nodes = path->getNodes();
+            for(std::size_t k = 1; k < path_nodes.size(); k++) {
+                EXPECT_TRUE(graph.areNeighbours(path_nodes[k - 1], path_nodes[k]));
+                EXPECT_TRUE(graph.isWalkableNode(path_nodes[k]));
+            }
+        }
+    }
+}
+
+TEST(RectangleSymmetryTest, RectangleDecompositionFileTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, false, true, true},
+        std::vector{true, true, true, true, true},
+        std::vector{true, false, false, false, true}};
+
+    std::vector other{
+        std::vector{true, true},
+        std::vector{true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+    GridGraph graph_other{other, graph::ManhattanNeigbourCalculator{}};
+
+    RectangleDecomposition rectangles{graph_test1};
+
+    const auto file = (std::filesystem::temp_directory_path() / "rsr_test").string();
+    ASSERT_TRUE(rectangles.toFile(file));
+
+    const auto loaded = pathfinding::rectangleDecompositionFromFile(graph_test1, file);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->getNumberOfRectangles(), rectangles.getNumberOfRectangles());
+
+    for(auto node : graph_test1) {
+        EXPECT_EQ(loaded->getRectangleIdOf(node), rectangles.getRectangleIdOf(node));
+    }
+
+    EXPECT_FALSE(pathfinding::rectangleDecompositionFromFile(graph_other, file));
+
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,122 @@
+#include <chrono>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/SearchBudget.hpp>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::SearchBudget;
+using pathfinding::SuboptimalSearch;
+
+
+TEST(SearchBudgetTest, DijkstraBudgetTest)
+{
+    std::vector test1(50, std::vector(50, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    GridGraphDijkstra d{graph_test1};
+
+    const Node source{0, 0};
+    const Node target{49, 49};
+    const auto budget = SearchBudget::fromExpansions(100);
+
+    //every query continues the search of the last one
+    graph::Distance last_lower_bound = 0;
+    std::size_t number_of_queries = 0;
+    while(true) {
+        const auto result = d.findDistance(source, target, budget);
+        number_of_queries++;
+
+        if(!result.budget_exceeded) {
+            EXPECT_EQ(result.lower_bound, 98);
+            EXPECT_EQ(result.upper_bound, 98);
+            break;
+        }
+
+        EXPECT_GE(result.lower_bound, last_lower_bound);
+        EXPECT_LE(result.lower_bound, 98);
+        EXPECT_GE(result.upper_bound, 98);
+        last_lower_bound = result.lower_bound;
+    }
+
+    EXPECT_GE(number_of_queries, graph_test1.size() / 100);
+
+    //a deadline in the past stops the search before the first expansion
+    const auto expired = SearchBudget::fromTimeout(std::chrono::seconds{-1});
+    const auto result = d.findDistance(Node{49, 0}, target, expired);
+    EXPECT_TRUE(result.budget_exceeded);
+    EXPECT_EQ(result.lower_bound, 0);
+    EXPECT_EQ(result.upper_bound, graph::UNREACHABLE);
+
+    //without limits the budget does not change the result
+    const auto unlimited = d.findDistance(Node{49, 0}, target, SearchBudget{});
+    EXPECT_FALSE(unlimited.budget_exceeded);
+    EXPECT_EQ(unlimited.lower_bound, 49);
+}
+
+TEST(SearchBudgetTest, AStarBudgetTest)
+{
+    std::vector test1(30, std::vector(30, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    //a wall with a single gap at the end forces a detour
+    for(std::size_t column = 0; column < 29; column++) {
+        graph_test1.setBarrier(Node{15, column}, true);
+    }
+
+    const Node source{0, 0};
+    const Node target{29, 0};
+    const graph::Distance expected = 29 + 2 * 29;
+
+    AStar astar{graph_test1};
+
+    const auto budget = SearchBudget::fromExpansions(50);
+    const auto route = astar.findRoute(source, target, budget);
+
+    ASSERT_TRUE(route.distance.budget_exceeded);
+    EXPECT_LE(route.distance.lower_bound, expected);
+    EXPECT_GE(route.distance.upper_bound, expected);
+    EXPECT_EQ(astar.getNumberOfExpandedNodes(), 50);
+
+    //the partial path starts at the source and ends at the frontier
+    ASSERT_TRUE(route.path);
+    const auto& nodes = route.path->getNodes();
+    EXPECT_EQ(nodes.front(), source);
+    for(std::size_t i = 1; i < nodes.size(); i++) {
+        EXPECT_TRUE(graph_test1.areNeighbours(nodes[i - 1], nodes[i]));
+    }
+
+    //the search continues until the target is found
+    auto result = route.distance;
+    while(result.budget_exceeded) {
+        result = astar.findDistance(source, target, budget);
+    }
+    EXPECT_EQ(result.lower_bound, expected);
+
+    const auto complete = astar.findRoute(source, target, SearchBudget{});
+    EXPECT_FALSE(complete.distance.budget_exceeded);
+    ASSERT_TRUE(complete.path);
+    EXPECT_EQ(static_cast<graph::Distance>(complete.path->getLength()), expected);
+
+    //the bounds of the suboptimal searches hold as well
+    for(auto search : {SuboptimalSearch::WEIGHTED, SuboptimalSearch::FOCAL}) {
+        astar.setSuboptimality(0.5, search);
+        const auto bounded = astar.findRoute(source, target, budget);
+
+        ASSERT_TRUE(bounded.distance.budget_exceeded);
+        EXPECT_LE(bounded.distance.lower_bound, expected);
+        EXPECT_GE(bounded.distance.upper_bound, expected);
+        ASSERT_TRUE(bounded.path);
+        EXPECT_EQ(bounded.path->getSource(), source);
+    }
+}
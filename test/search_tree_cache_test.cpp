@@ -0,0 +1,136 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/SearchTreeCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::GridGraphDijkstra;
+using pathfinding::SearchTreeCache;
+
+
+TEST(SearchTreeCacheTest, SearchTreeCacheWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    SearchTreeCache cache{graph_test1, 3};
+
+    test::forAllPairs(graph_test1, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(cache.findDistance(from, to), expected);
+
+        const auto path = cache.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            EXPECT_EQ(path->getSource(), from);
+            EXPECT_EQ(path->getTarget(), to);
+
+            const auto& nodes = path->getNodes();
+            for(std::size_t i = 1; i < nodes.size(); i++) {
+                EXPECT_TRUE(graph_test1.areNeighbours(nodes[i - 1], nodes[i]));
+            }
+        }
+    });
+
+    EXPECT_LE(cache.getNumberOfCachedTrees(), 3);
+    EXPECT_EQ(cache.findDistance(Node{0, 2}, Node{0, 0}), graph::UNREACHABLE);
+}
+
+TEST(SearchTreeCacheTest, SearchTreeCacheHitMissTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    SearchTreeCache cache{graph_test1, 2};
+
+    const Node base{0, 0};
+    const Node spawn{19, 19};
+    const Node objective{10, 5};
+
+    //the first query computes the tree of the source
+    EXPECT_EQ(cache.findDistance(base, objective), 15);
+    EXPECT_EQ(cache.getNumberOfMisses(), 1);
+    EXPECT_EQ(cache.getNumberOfHits(), 0);
+
+    //the tree of the base can also answer queries which end at the base
+    EXPECT_EQ(cache.findDistance(spawn, base), 38);
+    EXPECT_EQ(cache.getNumberOfMisses(), 1);
+    EXPECT_EQ(cache.getNumberOfHits(), 1);
+
+    EXPECT_EQ(cache.findDistance(spawn, objective), 23);
+    EXPECT_EQ(cache.findDistance(objective, spawn), 23);
+    EXPECT_EQ(cache.getNumberOfMisses(), 2);
+    EXPECT_EQ(cache.getNumberOfHits(), 2);
+    EXPECT_EQ(cache.getNumberOfCachedTrees(), 2);
+    EXPECT_EQ(cache.getCacheSize(),
+              2 * graph_test1.size() * (sizeof(graph::Distance) + sizeof(std::uint8_t)));
+
+    //the tree of the base is the least recently used one and gets evicted
+    EXPECT_EQ(cache.findDistance(objective, Node{5, 5}), 5);
+    EXPECT_EQ(cache.getNumberOfMisses(), 3);
+    EXPECT_EQ(cache.findDistance(base, Node{1, 1}), 2);
+    EXPECT_EQ(cache.getNumberOfMisses(), 4);
+    EXPECT_EQ(cache.getNumberOfCachedTrees(), 2);
+
+    //barrier updates invalidate all cached trees
+    for(std::size_t column = 0; column < 19; column++) {
+        graph_test1.setBarrier(Node{10, column}, true);
+    }
+
+    GridGraphDijkstra d{graph_test1};
+    EXPECT_EQ(cache.findDistance(base, spawn), d.findDistance(base, spawn));
+    EXPECT_EQ(cache.getNumberOfMisses(), 5);
+    EXPECT_EQ(cache.getNumberOfCachedTrees(), 1);
+}
+
+TEST(SearchTreeCacheTest, SearchTreeCacheEvictionOrderTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    SearchTreeCache cache{graph_test1, 3};
+
+    //the target is never a root, so only the trees of the sources are used
+    const Node target{19, 19};
+    const Node a{0, 0};
+    const Node b{0, 5};
+    const Node c{5, 0};
+    const Node d{5, 5};
+
+    const auto query = [&](Node source, std::size_t hits, std::size_t misses) {
+        const auto row_dist = target.row - source.row;
+        const auto column_dist = target.column - source.column;
+        EXPECT_EQ(cache.findDistance(source, target),
+                  static_cast<graph::Distance>(row_dist + column_dist));
+        EXPECT_EQ(cache.getNumberOfHits(), hits);
+        EXPECT_EQ(cache.getNumberOfMisses(), misses);
+    };
+
+    query(a, 0, 1);
+    query(b, 0, 2);
+    query(c, 0, 3);
+
+    //a hit moves a to the front, b is the least recently used tree now
+    query(a, 1, 3);
+    query(d, 1, 4);
+    EXPECT_EQ(cache.getNumberOfCachedTrees(), 3);
+
+    query(c, 2, 4);
+    query(a, 3, 4);
+    query(b, 3, 5);
+
+    //d was evicted for b, c is the oldest tree now and makes room for d
+    query(d, 3, 6);
+    query(a, 4, 6);
+    query(b, 5, 6);
+    query(c, 5, 7);
+    EXPECT_EQ(cache.getNumberOfCachedTrees(), 3);
+}
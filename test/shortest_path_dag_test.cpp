@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <pathfinding/ShortestPathDag.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::DistanceGridGraphDijkstra;
+using pathfinding::ShortestPathDag;
+
+
+TEST(ShortestPathDagTest, ShortestPathDagWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    ShortestPathDag dag{graph_test1};
+    DistanceGridGraphDijkstra from_source{graph_test1};
+    DistanceGridGraphDijkstra from_target{graph_test1};
+
+    for(auto source : graph_test1) {
+        for(auto target : graph_test1) {
+            const auto expected = from_source.findDistance(source, target);
+            EXPECT_EQ(dag.findDistance(source, target), expected);
+
+            const auto dag_nodes = dag.findDagNodes(source, target);
+            if(expected == graph::UNREACHABLE) {
+                EXPECT_TRUE(dag_nodes.empty());
+                continue;
+            }
+
+            //exactly the nodes on a shortest path are part of the dag
+            std::size_t number_of_dag_nodes = 0;
+            for(auto n : graph_test1) {
+                const auto to_source = from_source.findDistance(source, n);
+                const auto to_target = from_target.findDistance(target, n);
+                number_of_dag_nodes += to_source != graph::UNREACHABLE
+                    and to_source + to_target == expected;
+            }
+
+            EXPECT_EQ(dag_nodes.size(), number_of_dag_nodes);
+            EXPECT_EQ(dag_nodes.front(), source);
+            EXPECT_EQ(dag_nodes.back(), target);
+
+            for(auto n : dag_nodes) {
+                EXPECT_EQ(from_source.findDistance(source, n) + from_target.findDistance(target, n),
+                          expected);
+            }
+        }
+    }
+}
+
+TEST(ShortestPathDagTest, DominatorsTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    ShortestPathDag dag{graph_test1};
+    DistanceGridGraphDijkstra d{graph_test1};
+
+    std::vector<Node> nodes;
+    for(auto n : graph_test1) {
+        nodes.emplace_back(n);
+    }
+
+    for(std::size_t i = 0; i < nodes.size(); i += 5) {
+        for(std::size_t j = 0; j < nodes.size(); j += 3) {
+            const auto source = nodes[i];
+            const auto target = nodes[j];
+            const auto distance = d.findDistance(source, target);
+            const auto dominators = dag.findDominators(source, target);
+
+            if(distance == graph::UNREACHABLE) {
+                EXPECT_TRUE(dominators.empty());
+                continue;
+            }
+
+            ASSERT_FALSE(dominators.empty());
+            EXPECT_EQ(dominators.front(), source);
+            EXPECT_EQ(dominators.back(), target);
+
+            //a node lies on every shortest path iff every path avoiding it is longer
+            for(auto n : nodes) {
+                if(n == source or n == target) {
+                    continue;
+                }
+
+                graph_test1.setBarrier(n, true);
+                const auto is_dominator = d.findDistance(source, target) != distance;
+                graph_test1.setBarrier(n, false);
+
+                const auto found = std::find(std::begin(dominators),
+                                             std::end(dominators),
+                                             n)
+                    != std::end(dominators);
+
+                EXPECT_EQ(found, is_dominator);
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <pathfinding/SubgoalAStar.hpp>
+#include <pathfinding/SubgoalGraph.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::SubgoalAStar;
+using pathfinding::SubgoalGraph;
+
+namespace {
+
+auto checkRoutes(const GridGraph& graph, SubgoalAStar& subgoal_astar)
+    -> void
+{
+    test::forAllPairs(graph, [&](auto from, auto to, auto expected) {
+        EXPECT_EQ(subgoal_astar.findDistance(from, to), expected);
+
+        const auto path = subgoal_astar.findRoute(from, to);
+        ASSERT_EQ(!!path, expected != graph::UNREACHABLE);
+
+        if(path) {
+            EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), expected);
+            EXPECT_EQ(path->getSource(), from);
+            EXPECT_EQ(path->getTarget(), to);
+
+            const auto& nodes = path->getNodes();
+            for(std::size_t i = 1; i < nodes.size(); i++) {
+                EXPECT_TRUE(graph.isWalkableNode(nodes[i]));
+                EXPECT_TRUE(nodes[i].isManhattanNeigbourOf(nodes[i - 1]));
+            }
+        }
+    });
+}
+
+auto checkAllPairs(const GridGraph& graph)
+    -> void
+{
+    SubgoalGraph subgoals{graph};
+    SubgoalAStar subgoal_astar{subgoals};
+
+    checkRoutes(graph, subgoal_astar);
+}
+
+} // namespace
+
+
+TEST(SubgoalGraphTest, SubgoalAStarWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    checkAllPairs(graph_test1);
+}
+
+TEST(SubgoalGraphTest, SubgoalAStarOutdatedTest)
+{
+    auto graph_test1 = test::makeBarrierGraph();
+
+    SubgoalGraph subgoals{graph_test1};
+    SubgoalAStar subgoal_astar{subgoals};
+
+    //edges of the old subgoals can cross the new barrier and miss the new gap
+    graph_test1.setBarrier({4, 6}, true);
+    graph_test1.setBarrier({3, 2}, false);
+
+    EXPECT_FALSE(subgoals.isUpToDate());
+    checkRoutes(graph_test1, subgoal_astar);
+}
+
+TEST(SubgoalGraphTest, SubgoalAStarRandomGridTest)
+{
+    std::mt19937 gen{42};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    for(std::size_t round = 0; round < 5; round++) {
+        std::vector grid(12, std::vector(12, true));
+        for(auto& row : grid) {
+            for(std::size_t column = 0; column < row.size(); column++) {
+                row[column] = is_walkable(gen);
+            }
+        }
+
+        GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+        checkAllPairs(graph);
+    }
+}
+
+TEST(SubgoalGraphTest, SubgoalGraphOpenGridTest)
+{
+    std::vector open(20, std::vector(20, true));
+    for(std::size_t row = 3; row < 17; row++) {
+        open[row][10] = false;
+    }
+
+    GridGraph graph{open, graph::ManhattanNeigbourCalculator{}};
+
+    SubgoalGraph subgoals{graph};
+
+    //the wall has two ends with two convex corners each
+    EXPECT_EQ(subgoals.getNumberOfSubgoals(), 4);
+    EXPECT_TRUE(subgoals.isSubgoal(Node{2, 9}));
+    EXPECT_TRUE(subgoals.isSubgoal(Node{17, 11}));
+    EXPECT_FALSE(subgoals.isSubgoal(Node{10, 9}));
+
+    SubgoalAStar subgoal_astar{subgoals};
+    AStar astar{graph};
+
+    const Node from{10, 2};
+    const Node to{10, 18};
+
+    EXPECT_EQ(subgoal_astar.findDistance(from, to), astar.findDistance(from, to));
+    EXPECT_LT(subgoal_astar.getNumberOfExpandedNodes(), astar.getNumberOfExpandedNodes());
+}
+
+TEST(SubgoalGraphTest, SubgoalAStarAllSouroundingGraphTest)
+{
+    std::mt19937 gen{7};
+    std::bernoulli_distribution is_barrier{0.2};
+
+    std::vector grid(20, std::vector(20, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = !is_barrier(gen);
+        }
+    }
+
+    //the subgoal graph only uses manhattan neigbours, also on 8-connected graphs
+    GridGraph graph_test1{grid, graph::AllSouroundingNeigbourCalculator{}};
+
+    SubgoalGraph subgoals{graph_test1};
+    SubgoalAStar subgoal_astar{subgoals};
+    AStar astar{graph_test1};
+
+    for(auto from : graph_test1) {
+        for(auto to : graph_test1) {
+            EXPECT_EQ(subgoal_astar.findDistance(from, to), astar.findDistance(from, to));
+        }
+    }
+}
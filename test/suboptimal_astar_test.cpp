@@ -0,0 +1,106 @@
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <graph/GridGraph.hpp>
+#include <pathfinding/AStar.hpp>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "test_graphs.hpp"
+
+using graph::GridGraph;
+using graph::Node;
+using pathfinding::AStar;
+using pathfinding::SuboptimalSearch;
+
+namespace {
+
+auto checkSuboptimalAStar(const GridGraph& graph, double epsilon, SuboptimalSearch search)
+    -> void
+{
+    AStar astar{graph};
+    astar.setSuboptimality(epsilon, search);
+
+    test::forAllPairs(graph, [&](auto from, auto to, auto expected) {
+        const auto distance = astar.findDistance(from, to);
+
+        if(expected == graph::UNREACHABLE) {
+            EXPECT_EQ(distance, graph::UNREACHABLE);
+            return;
+        }
+
+        const auto bound = astar.getSuboptimalityBound();
+        EXPECT_GE(distance, expected);
+        EXPECT_LE(bound, 1 + epsilon);
+        EXPECT_LE(distance, bound * expected + 1e-9);
+
+        const auto path = astar.findRoute(from, to);
+        ASSERT_TRUE(path);
+        EXPECT_EQ(static_cast<graph::Distance>(path->getLength()), distance);
+        EXPECT_EQ(path->getSource(), from);
+        EXPECT_EQ(path->getTarget(), to);
+    });
+}
+
+} // namespace
+
+
+TEST(SuboptimalAStarTest, SuboptimalAStarWithBarriersTest)
+{
+    const auto graph_test1 = test::makeBarrierGraph();
+
+    for(auto epsilon : {0.0, 0.1, 0.5, 2.0}) {
+        checkSuboptimalAStar(graph_test1, epsilon, SuboptimalSearch::WEIGHTED);
+        checkSuboptimalAStar(graph_test1, epsilon, SuboptimalSearch::FOCAL);
+    }
+}
+
+TEST(SuboptimalAStarTest, SuboptimalAStarRandomGridTest)
+{
+    std::mt19937 gen{7};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    for(int round = 0; round < 3; round++) {
+        std::vector grid(15, std::vector(15, true));
+        for(auto& row : grid) {
+            for(std::size_t column = 0; column < row.size(); column++) {
+                row[column] = is_walkable(gen);
+            }
+        }
+
+        GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+        checkSuboptimalAStar(graph, 0.2, SuboptimalSearch::WEIGHTED);
+        checkSuboptimalAStar(graph, 0.2, SuboptimalSearch::FOCAL);
+    }
+}
+
+TEST(SuboptimalAStarTest, ExactSearchBoundTest)
+{
+    std::vector test1(20, std::vector(20, true));
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    AStar astar{graph_test1};
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{19, 19}), 38);
+    EXPECT_EQ(astar.getSuboptimalityBound(), 1);
+
+    //on an open grid the manhattan distance proves that the path is optimal
+    astar.setSuboptimality(0.5, SuboptimalSearch::FOCAL);
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{19, 19}), 38);
+    EXPECT_EQ(astar.getSuboptimalityBound(), 1);
+
+    astar.setSuboptimality(0.5);
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{19, 19}), 38);
+    EXPECT_EQ(astar.getSuboptimalityBound(), 1);
+
+    //a wall with a single gap at the end forces a detour
+    for(std::size_t column = 0; column < 19; column++) {
+        graph_test1.setBarrier(Node{10, column}, true);
+    }
+
+    astar.setSuboptimality(0);
+    EXPECT_EQ(astar.findDistance(Node{0, 0}, Node{19, 0}), 19 + 2 * 19);
+    EXPECT_EQ(astar.getSuboptimalityBound(), 1);
+}
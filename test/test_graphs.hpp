@@ -0,0 +1,46 @@
+#pragma once
+
+#include <graph/GridGraph.hpp>
+#include <graph/NeigbourCalculator.hpp>
+#include <graph/Node.hpp>
+#include <pathfinding/GridGraphDijkstra.hpp>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+// 9x12 grid with walls, dead ends and an open area on the right, most engine
+// tests compare all of its pairs against dijkstra
+inline auto makeBarrierGraph(graph::NeigbourCalculator neigbour_calculator = graph::ManhattanNeigbourCalculator{})
+    -> graph::GridGraph
+{
+    std::vector grid{
+        std::vector{true, true, false, true, true, true, true, true, true, true, true, true},
+        std::vector{true, true, false, true, true, false, true, true, true, false, true, true},
+        std::vector{true, true, true, true, true, false, true, true, true, false, true, true},
+        std::vector{true, false, false, false, true, false, false, false, true, false, true, true},
+        std::vector{true, true, true, true, true, true, true, true, true, false, true, true},
+        std::vector{false, false, true, false, false, false, true, false, false, false, true, true},
+        std::vector{true, true, true, true, true, false, true, true, true, true, true, true},
+        std::vector{true, true, false, true, true, false, true, true, true, true, true, true},
+        std::vector{true, true, true, true, true, false, true, true, true, true, true, true}};
+
+    return graph::GridGraph{std::move(grid), neigbour_calculator};
+}
+
+// calls check(source, target, expected) for all pairs of walkable nodes,
+// expected is the distance found by dijkstra
+template<class Check>
+auto forAllPairs(const graph::GridGraph& graph, Check&& check)
+    -> void
+{
+    pathfinding::DistanceGridGraphDijkstra d{graph};
+
+    for(auto source : graph) {
+        for(auto target : graph) {
+            check(source, target, d.findDistance(source, target));
+        }
+    }
+}
+
+} // namespace test
@@ -0,0 +1,119 @@
+#include <filesystem>
+#include <graph/GridGraph.hpp>
+#include <random>
+#include <utils/TuningProfile.hpp>
+
+#include <gtest/gtest.h>
+
+using graph::GridGraph;
+using utils::EngineCalibration;
+using utils::TunedEngine;
+using utils::TuningProfile;
+
+
+TEST(TuningProfileTest, CalibrationTest)
+{
+    std::mt19937 gen{29};
+    std::bernoulli_distribution is_walkable{0.7};
+
+    std::vector grid(25, std::vector(30, true));
+    for(auto& row : grid) {
+        for(std::size_t column = 0; column < row.size(); column++) {
+            row[column] = is_walkable(gen);
+        }
+    }
+
+    GridGraph graph{grid, graph::ManhattanNeigbourCalculator{}};
+
+    //without separations only the searches are calibrated
+    const auto profile = utils::calibrateEngines(graph, {}, 50, 3);
+    const auto& calibrations = profile.getCalibrations();
+
+    ASSERT_EQ(calibrations.size(), 2u);
+    EXPECT_EQ(calibrations[0].engine, TunedEngine::DIJKSTRA);
+    EXPECT_EQ(calibrations[1].engine, TunedEngine::ASTAR);
+
+    //the searches keep at least one distance per node
+    for(const auto& calibration : calibrations) {
+        EXPECT_GE(calibration.query_time, 0.0);
+        EXPECT_GE(calibration.memory_usage, graph.size() * sizeof(graph::Distance));
+    }
+
+    EXPECT_NE(profile.getRecommendedEngine(), TunedEngine::SEPARATION_ORACLE);
+}
+
+TEST(TuningProfileTest, TuningProfileFileTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true},
+        std::vector{true, true, true, true},
+        std::vector{true, false, true, true}};
+
+    std::vector other{
+        std::vector{true, true, true, true},
+        std::vector{true, true, true, true},
+        std::vector{true, false, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+    GridGraph graph_other{other, graph::ManhattanNeigbourCalculator{}};
+
+    const TuningProfile profile{graph_test1,
+                                {EngineCalibration{TunedEngine::DIJKSTRA, 0.0, 3e-5, 200},
+                                 EngineCalibration{TunedEngine::ASTAR, 0.0, 1e-5, 300},
+                                 EngineCalibration{TunedEngine::SEPARATION_ORACLE, 2.5, 2e-5, 1024}}};
+
+    EXPECT_EQ(profile.getRecommendedEngine(), TunedEngine::ASTAR);
+
+    const auto file = (std::filesystem::temp_directory_path() / "tuning_profile_test").string();
+    ASSERT_TRUE(profile.toFile(file));
+
+    const auto loaded = utils::tuningProfileFromFile(graph_test1, file);
+    ASSERT_TRUE(loaded);
+    ASSERT_EQ(loaded->getCalibrations().size(), 3u);
+    EXPECT_EQ(loaded->getRecommendedEngine(), TunedEngine::ASTAR);
+    EXPECT_EQ(loaded->getCalibrations()[2].engine, TunedEngine::SEPARATION_ORACLE);
+    EXPECT_EQ(loaded->getCalibrations()[2].preprocessing_time, 2.5);
+    EXPECT_EQ(loaded->getCalibrations()[2].memory_usage, 1024u);
+
+    //same size but other barriers
+    EXPECT_FALSE(utils::tuningProfileFromFile(graph_other, file));
+
+    //nor for a moved barrier, size and number of walkable nodes are the same
+    graph_test1.toggleBarrier(graph::Node{0, 2});
+    graph_test1.toggleBarrier(graph::Node{0, 3});
+    EXPECT_FALSE(utils::tuningProfileFromFile(graph_test1, file));
+
+    std::filesystem::remove(file);
+}
+
+TEST(TuningProfileTest, RecommendationMemoryTest)
+{
+    std::vector test1{
+        std::vector{true, true, false, true},
+        std::vector{true, true, true, true},
+        std::vector{true, false, true, true}};
+
+    GridGraph graph_test1{test1, graph::ManhattanNeigbourCalculator{}};
+
+    const TuningProfile profile{graph_test1,
+                                {EngineCalibration{TunedEngine::DIJKSTRA, 0.0, 3e-5, 200},
+                                 EngineCalibration{TunedEngine::ASTAR, 0.0, 1.05e-5, 300},
+                                 EngineCalibration{TunedEngine::SEPARATION_ORACLE, 2.5, 1e-5, 1024}}};
+
+    //a* is less than 10% slower than the oracle but uses less memory
+    EXPECT_EQ(profile.getRecommendedEngine(), TunedEngine::ASTAR);
+
+    //the fastest engine which fits into the limit
+    EXPECT_EQ(profile.getRecommendedEngine(2048), TunedEngine::ASTAR);
+    EXPECT_EQ(profile.getRecommendedEngine(250), TunedEngine::DIJKSTRA);
+
+    //nothing fits, the smallest engine is used
+    EXPECT_EQ(profile.getRecommendedEngine(100), TunedEngine::DIJKSTRA);
+
+    const TuningProfile oracle_profile{graph_test1,
+                                       {EngineCalibration{TunedEngine::DIJKSTRA, 0.0, 3e-5, 200},
+                                        EngineCalibration{TunedEngine::SEPARATION_ORACLE, 2.5, 1e-5, 1024}}};
+
+    EXPECT_EQ(oracle_profile.getRecommendedEngine(), TunedEngine::SEPARATION_ORACLE);
+    EXPECT_EQ(oracle_profile.getRecommendedEngine(1000), TunedEngine::DIJKSTRA);
+}